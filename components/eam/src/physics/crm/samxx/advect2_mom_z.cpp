@@ -18,9 +18,9 @@ void advect2_mom_z() {
   YAKL_SCOPE( adzw           , :: adzw);
   YAKL_SCOPE( ncrms          , :: ncrms);
 
-  real4d fuz("fuz",nz ,ny,nx,ncrms);
-  real4d fvz("fvz",nz ,ny,nx,ncrms);
-  real4d fwz("fwz",nzm,ny,nx,ncrms);
+  real4d fuz = workspace::get_real4d("advect2_mom_z","fuz",nz ,ny,nx,ncrms);
+  real4d fvz = workspace::get_real4d("advect2_mom_z","fvz",nz ,ny,nx,ncrms);
+  real4d fwz = workspace::get_real4d("advect2_mom_z","fwz",nzm,ny,nx,ncrms);
 
   // for (int k=0; k<nzm; k++) {
   //       for (int icrm=0; icrm<ncrms; icrm++) {
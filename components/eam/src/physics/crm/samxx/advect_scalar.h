@@ -3,6 +3,7 @@
 
 #include "samxx_const.h"
 #include "vars.h"
+#include "samxx_workspace.h"
 #include "advect_scalar2D.h"
 #include "advect_scalar3D.h"
 
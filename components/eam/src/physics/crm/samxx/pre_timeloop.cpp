@@ -502,4 +502,8 @@ void pre_timeloop() {
     crm_accel_nstop(nstop);  // reduce nstop by factor of (1 + crm_accel_factor)
   }
 
+  // pre-size the scratch arrays reused by every CRM substep
+  workspace::init();
+  pressure_init();
+
 }
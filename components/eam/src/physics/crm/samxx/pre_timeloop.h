@@ -3,6 +3,7 @@
 
 #include "samxx_const.h"
 #include "vars.h"
+#include "samxx_workspace.h"
 #include "task_init.h"
 #include "setparm.h"
 #include "microphysics.h"
@@ -11,6 +12,7 @@
 #include "accelerate_crm.h"
 #include "setperturb.h"
 #include "crm_variance_transport.h"
+#include "pressure.h"
 
 void pre_timeloop();
 
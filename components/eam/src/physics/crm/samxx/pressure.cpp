@@ -1,56 +1,93 @@
 
 #include "pressure.h"
 
+// The pressure solve works on the full vertical column of each CRM, so the
+// spectral coefficients can be solved in place without slab transposes
+static_assert( nsubdomains == 1 , "SAMXX pressure() assumes a single subdomain per CRM" );
+
+
+void pressure_init() {
+  YAKL_SCOPE( dx            , :: dx );
+  YAKL_SCOPE( dy            , :: dy );
+  YAKL_SCOPE( ncrms         , :: ncrms );
+
+  int nx2 = nx+2;
+  int ny2 = ny+2*YES3D;
+  int nypp = RUN2D ? 1 : ny+2;
+
+  real4d f    = workspace::get_real4d("pressure", "f"   , nzm, ny2, nx2, ncrms);
+  real2d eign = workspace::get_real2d("pressure", "eign", nypp, nx+1);
+
+  // Build the FFT plans once for all (k, j, icrm) slabs; every substep reuses them
+  #ifndef USE_ORIG_FFT
+    pressure_fftx.init(f, 2, nx);
+    if (RUN3D) { pressure_ffty.init(f, 1, ny); }
+  #endif
+
+  // The eigenvalues of the horizontal Laplacian do not change during the CRM call
+  //   for (int j=0; j<nypp; j++) {
+  //     for (int i=0; i<nx+1; i++) {
+  parallel_for( SimpleBounds<2>(nypp,nx+1) , YAKL_LAMBDA (int j, int i) {
+    int jt = 0;
+    int it = 0;
+
+    real ddx2=1.0/(dx*dx);
+    real ddy2=1.0/(dy*dy);
+    real pii = 3.14159265358979323846;
+    real xnx=pii/nx;
+    real xny=pii/ny;
+    int jd=((j+1)+jt-0.1)/2.0;
+    real facty = 2.0;
+    real xj=jd;
+    int id=((i+1)+it-0.1)/2.0;
+    real factx = 2.0;
+    real xi=id;
+    eign(j,i)=(2.0*cos(factx*xnx*xi)-2.0)*ddx2+(2.0*cos(facty*xny*xj)-2.0)*ddy2;
+  });
+}
+
+
 void pressure() {
   YAKL_SCOPE( p             , :: p );
   YAKL_SCOPE( rhow          , :: rhow );
   YAKL_SCOPE( adz           , :: adz );
   YAKL_SCOPE( adzw          , :: adzw );
   YAKL_SCOPE( dz            , :: dz );
-  YAKL_SCOPE( dx            , :: dx );
-  YAKL_SCOPE( dy            , :: dy );
   YAKL_SCOPE( rho           , :: rho );
   YAKL_SCOPE( ncrms         , :: ncrms );
 
-  int npressureslabs = nsubdomains;
-  int nzslab = max(1,nzm/npressureslabs); 
   int nx2 = nx+2;
   int ny2 = ny+2*YES3D;
   int constexpr n3i=3*nx_gl/2+1;
   int constexpr n3j=3*ny_gl/2+1;
-  int constexpr fftySize = ny > 4 ? ny : 4;
 
-  real4d f ("f" , nzslab, ny2, nx2, ncrms);
-  real4d ff("ff", nzm,ny2,nx+1,ncrms);
-  real2d a ("a" , nzm, ncrms);
-  real2d c ("c" , nzm, ncrms);
+  real4d f    = workspace::get_real4d("pressure", "f"   , nzm, ny2, nx2, ncrms);
 
-  int iwall = 0;
-  int nypp, jwall;
+  int nypp;
 
   if (RUN2D) {
     nypp = 1;
-    jwall = 0;
   } else {
     nypp = ny+2;
   }
 
-  real2d eign("eign",nypp,nx+1);
+  real2d eign = workspace::get_real2d("pressure", "eign", nypp, nx+1);
 
   press_rhs();
 
-  // for (int k=0; k<nzslab; k++) {
+  // for (int k=0; k<nzm; k++) {
   //   for (int j=0; j<ny; j++) {
   //     for (int i=0; i<nx; i++) {
   //       for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<4>(nzslab,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+  parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
     f(k,j,i,icrm) = p(k,j+offy_p,i+offx_p,icrm);
   });
 
   #ifndef USE_ORIG_FFT
 
-    pressure_fftx.forward_real(f, 2, nx);
-    if (RUN3D) { pressure_ffty.forward_real(f, 1, ny); }
+    // Batched over all (k, j, icrm) slabs with the plans from pressure_init()
+    pressure_fftx.forward_real(f);
+    if (RUN3D) { pressure_ffty.forward_real(f); }
 
   #else
 
@@ -68,7 +105,7 @@ void pressure() {
     fftfax_crm( nx_gl , ifaxi.data() , trigxi.data() );
     if (RUN3D) fftfax_crm( ny_gl , ifaxj.data() , trigxj.data() );
 
-    for (int k = 0 ; k < nzslab ; k++) {
+    for (int k = 0 ; k < nzm ; k++) {
       for (int j = 0 ; j < ny_gl ; j++) {
         for (int icrm = 0 ; icrm < ncrms ; icrm++) {
           for (int i=0 ; i < nx2 ; i++) { ftmp_x(i) = fHost(k,j,i,icrm); }
@@ -78,7 +115,7 @@ void pressure() {
       }
     }
     if (RUN3D) {
-      for (int k = 0 ; k < nzslab ; k++) {
+      for (int k = 0 ; k < nzm ; k++) {
         for (int i = 0 ; i < nx_gl+1 ; i++) {
           for (int icrm = 0 ; icrm < ncrms ; icrm++) {
             for (int j=0 ; j < ny2 ; j++) { ftmp_y(j) = fHost(k,j,i,icrm); }
@@ -93,41 +130,8 @@ void pressure() {
 
   #endif
 
-  // for(int k=0; k<nzslab; k++) {
-  //  for(int j=0; j<nypp; j++) {
-  //    for(int i=0; i<nx+1; i++) {
-  //      for(int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<4>(nzslab,nypp,nx+1,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-    ff(k,j,i,icrm) = f(k,j,i,icrm);
-  });
-
-  // for (int k=0; k<nzm; k++) {
-  //  for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<2>(nzm,ncrms) , YAKL_LAMBDA (int k, int icrm) {
-    a(k,icrm)=rhow(k,icrm)/(adz(k,icrm)*adzw(k,icrm)*dz(icrm)*dz(icrm));
-    c(k,icrm)=rhow(k+1,icrm)/(adz(k,icrm)*adzw(k+1,icrm)*dz(icrm)*dz(icrm));
-  });
-
-  //   for (int j=0; j<nypp; j++) {
-  //     for (int i=0; i<nx+1; i++) {
-  parallel_for( SimpleBounds<2>(nypp,nx+1) , YAKL_LAMBDA (int j, int i) {
-    int jt = 0;
-    int it = 0;
-
-    real ddx2=1.0/(dx*dx);
-    real ddy2=1.0/(dy*dy);
-    real pii = 3.14159265358979323846;
-    real xnx=pii/nx;
-    real xny=pii/ny;
-    int jd=((j+1)+jt-0.1)/2.0;
-    real facty = 2.0;
-    real xj=jd;
-    int id=((i+1)+it-0.1)/2.0;
-    real factx = 2.0;
-    real xi=id;
-    eign(j,i)=(2.0*cos(factx*xnx*xi)-2.0)*ddx2+(2.0*cos(facty*xny*xj)-2.0)*ddy2;
-  });
-
+  // Tridiagonal solve in spectral space, in place on f. The coefficients a and c
+  // are formed on the fly rather than stored.
   // for (int j=0; j<nypp; j++) {
   //  for (int i=0; i<nx+1; i++) {
   //    for (int icrm=0; icrm<ncrms; icrm++) {
@@ -139,39 +143,36 @@ void pressure() {
     int it = 0;
     int jd=((j+1)+jt-0.1)/2.0;
     int id=((i+1)+it-0.1)/2.0;
+    real a = rhow(0,icrm)/(adz(0,icrm)*adzw(0,icrm)*dz(icrm)*dz(icrm));
+    real c = rhow(1,icrm)/(adz(0,icrm)*adzw(1,icrm)*dz(icrm)*dz(icrm));
     real b;
     if(id+jd == 0) {
-      b=1.0/(eign(j,i)*rho(0,icrm)-a(0,icrm)-c(0,icrm));
-      alfa(0)=-c(0,icrm)*b;
-      beta(0)=ff(0,j,i,icrm)*b;
+      b=1.0/(eign(j,i)*rho(0,icrm)-a-c);
+      alfa(0)=-c*b;
+      beta(0)=f(0,j,i,icrm)*b;
     }
     else {
-      b=1.0/(eign(j,i)*rho(0,icrm)-c(0,icrm));
-      alfa(0)=-c(0,icrm)*b;
-      beta(0)=ff(0,j,i,icrm)*b;
+      b=1.0/(eign(j,i)*rho(0,icrm)-c);
+      alfa(0)=-c*b;
+      beta(0)=f(0,j,i,icrm)*b;
     }
 
     real e;
     for(int k=1; k<nzm-1; k++) {
-      e=1.0/(eign(j,i)*rho(k,icrm)-a(k,icrm)-c(k,icrm)+a(k,icrm)*alfa(k-1));
-      alfa(k)=-c(k,icrm)*e;
-      beta(k)=(ff(k,j,i,icrm)-a(k,icrm)*beta(k-1))*e;
+      a = rhow(k  ,icrm)/(adz(k,icrm)*adzw(k  ,icrm)*dz(icrm)*dz(icrm));
+      c = rhow(k+1,icrm)/(adz(k,icrm)*adzw(k+1,icrm)*dz(icrm)*dz(icrm));
+      e=1.0/(eign(j,i)*rho(k,icrm)-a-c+a*alfa(k-1));
+      alfa(k)=-c*e;
+      beta(k)=(f(k,j,i,icrm)-a*beta(k-1))*e;
     }
-    ff(nzm-1,j,i,icrm)=(ff(nzm-1,j,i,icrm)-a(nzm-1,icrm)*beta(nzm-2))/
-                       (eign(j,i)*rho(nzm-1,icrm)-a(nzm-1,icrm)+a(nzm-1,icrm)*alfa(nzm-2));
+    a = rhow(nzm-1,icrm)/(adz(nzm-1,icrm)*adzw(nzm-1,icrm)*dz(icrm)*dz(icrm));
+    f(nzm-1,j,i,icrm)=(f(nzm-1,j,i,icrm)-a*beta(nzm-2))/
+                      (eign(j,i)*rho(nzm-1,icrm)-a+a*alfa(nzm-2));
     for(int k=nzm-2; k>=0; k--) {
-      ff(k,j,i,icrm)=alfa(k)*ff(k+1,j,i,icrm)+beta(k);
+      f(k,j,i,icrm)=alfa(k)*f(k+1,j,i,icrm)+beta(k);
     }
   });
 
-  // for (int k=0; k<nzslab; k++) {
-  //   for (int j=0; j<nypp; j++) {
-  //     for (int i=0; i<nx+1; i++) {
-  //       for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<4>(nzslab,nypp,nx+1,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-    f(k,j,i,icrm) = ff(k,j,i,icrm);
-  });
-
   #ifndef USE_ORIG_FFT
 
     if (RUN3D) { pressure_ffty.inverse_real(f); }
@@ -183,7 +184,7 @@ void pressure() {
     yakl::fence();
 
     if (RUN3D) {
-      for (int k = 0 ; k < nzslab ; k++) {
+      for (int k = 0 ; k < nzm ; k++) {
         for (int i = 0 ; i < nx_gl+1 ; i++) {
           for (int icrm = 0 ; icrm < ncrms ; icrm++) {
             for (int j=0 ; j < ny2 ; j++) { ftmp_y(j) = fHost(k,j,i,icrm); }
@@ -194,7 +195,7 @@ void pressure() {
       }
     }
 
-    for (int k = 0 ; k < nzslab ; k++) {
+    for (int k = 0 ; k < nzm ; k++) {
       for (int j = 0 ; j < ny_gl ; j++) {
         for (int icrm = 0 ; icrm < ncrms ; icrm++) {
           for (int i=0 ; i < nx2 ; i++) { ftmp_x(i) = fHost(k,j,i,icrm); }
@@ -208,7 +209,7 @@ void pressure() {
 
   #endif
 
-  parallel_for( SimpleBounds<4>(nzslab,dimy_p,nx+1,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+  parallel_for( SimpleBounds<4>(nzm,dimy_p,nx+1,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
     int jj, ii;
 
     if (YES3D) {
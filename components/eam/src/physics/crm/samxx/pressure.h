@@ -4,11 +4,15 @@
 #include "samxx_const.h"
 #include "YAKL_fft.h"
 #include "vars.h"
+#include "samxx_workspace.h"
 #include "press_rhs.h"
 #include "press_grad.h"
 
 extern "C" void fftfax_crm(int n, int *ifax, real *trigs);
 extern "C" void fft991_crm(real *a, real *work, real *trigs, int *ifax, int inc, int jump, int n, int lot, int isign);
 
+// Build the FFT plans and Laplacian eigenvalues reused by every pressure() call
+void pressure_init();
+
 void pressure();
 
@@ -0,0 +1,113 @@
+
+#include "samxx_workspace.h"
+#include "vars.h"
+#include <algorithm>
+#include <map>
+#include <vector>
+
+namespace workspace {
+
+  namespace {
+    template <class T>
+    struct Entry {
+      T                arr;
+      std::vector<int> dims;
+    };
+
+    std::map<std::string,Entry<real4d>> pool4d;
+    std::map<std::string,Entry<real2d>> pool2d;
+
+    #ifdef SAMXX_WORKSPACE_DEBUG
+      // Bytes currently held and peak bytes held by each routine, and the
+      // number of requests it made
+      std::map<std::string,size_t> routine_bytes;
+      std::map<std::string,size_t> routine_peak;
+      std::map<std::string,size_t> routine_calls;
+    #endif
+
+    void allocate(real4d &arr, std::string const &key, std::vector<int> const &dims) {
+      arr = real4d(key.c_str(),dims[0],dims[1],dims[2],dims[3]);
+    }
+
+    void allocate(real2d &arr, std::string const &key, std::vector<int> const &dims) {
+      arr = real2d(key.c_str(),dims[0],dims[1]);
+    }
+
+    template <class T>
+    T get(std::map<std::string,Entry<T>> &pool, std::string const &routine, std::string const &label,
+          std::vector<int> const &dims) {
+      std::string key = routine + "::" + label;
+      auto it = pool.find(key);
+      #ifdef SAMXX_WORKSPACE_DEBUG
+        routine_calls[routine]++;
+      #endif
+      if (it != pool.end() && it->second.dims == dims) { return it->second.arr; }
+
+      // First request, or the shape changed (e.g. ncrms differs): (re)allocate
+      Entry<T> entry;
+      entry.dims = dims;
+      allocate(entry.arr,key,dims);
+      #ifdef SAMXX_WORKSPACE_DEBUG
+        if (it != pool.end()) { routine_bytes[routine] -= it->second.arr.get_totElems()*sizeof(real); }
+        routine_bytes[routine] += entry.arr.get_totElems()*sizeof(real);
+        routine_peak [routine]  = std::max( routine_peak[routine] , routine_bytes[routine] );
+      #endif
+      pool[key] = entry;
+      return entry.arr;
+    }
+  }
+
+
+  void init() {
+    int nypp = RUN2D ? 1 : ny+2;
+
+    get_real4d( "pressure" , "f"    , nzm  , ny+2*YES3D , nx+2 , ncrms );
+    get_real2d( "pressure" , "eign" , nypp , nx+1 );
+
+    get_real4d( "advect2_mom_z" , "fuz" , nz  , ny , nx , ncrms );
+    get_real4d( "advect2_mom_z" , "fvz" , nz  , ny , nx , ncrms );
+    get_real4d( "advect2_mom_z" , "fwz" , nzm , ny , nx , ncrms );
+
+    get_real4d( "advect_scalar" , "f0"  , nzm , dimy_s , dimx_s , ncrms );
+
+    #ifdef SAMXX_WORKSPACE_DEBUG
+      // Only count what the time loop requests, not the pre-sizing above
+      routine_calls.clear();
+    #endif
+  }
+
+
+  void finalize() {
+    yakl::fence();
+
+    #ifdef SAMXX_WORKSPACE_DEBUG
+      if (masterproc) {
+        size_t total = 0;
+        for (auto const &rp : routine_peak) {
+          std::cout << "SAMXX workspace: " << std::setw(20) << rp.first << " : "
+                    << std::setw(12) << rp.second << " bytes peak, "
+                    << routine_calls[rp.first] << " requests" << std::endl;
+          total += rp.second;
+        }
+        std::cout << "SAMXX workspace: total " << total << " bytes" << std::endl;
+      }
+      routine_bytes.clear();
+      routine_peak .clear();
+      routine_calls.clear();
+    #endif
+
+    pool4d.clear();
+    pool2d.clear();
+  }
+
+
+  real4d get_real4d(std::string const &routine, std::string const &label, int d0, int d1, int d2, int d3) {
+    return get(pool4d,routine,label,{d0,d1,d2,d3});
+  }
+
+
+  real2d get_real2d(std::string const &routine, std::string const &label, int d0, int d1) {
+    return get(pool2d,routine,label,{d0,d1});
+  }
+
+}
@@ -0,0 +1,31 @@
+
+#pragma once
+
+#include "samxx_const.h"
+#include <string>
+
+//////////////////////////////////////////////////////////////////////////////////
+// Persistent scratch arrays for the CRM time loop
+//
+// Routines called every CRM substep (pressure, advection, ...) request their
+// temporaries from this pool instead of allocating them on each call. Arrays
+// are keyed by routine and label, sized at pre_timeloop(), and released in
+// finalize(). Arrays handed out by the pool are NOT zeroed between calls, so
+// callers must fully overwrite whatever they read.
+//
+// Compile with -DSAMXX_WORKSPACE_DEBUG to report the peak scratch usage of
+// each routine when the pool is released.
+//////////////////////////////////////////////////////////////////////////////////
+
+namespace workspace {
+
+  // Pre-size the scratch arrays for the routines called inside timeloop()
+  void init();
+
+  // Release all scratch arrays (and print usage under SAMXX_WORKSPACE_DEBUG)
+  void finalize();
+
+  real4d get_real4d(std::string const &routine, std::string const &label, int d0, int d1, int d2, int d3);
+  real2d get_real2d(std::string const &routine, std::string const &label, int d0, int d1);
+
+}
@@ -1,5 +1,6 @@
 
 #include "vars.h"
+#include "samxx_workspace.h"
 
 void allocate() {
   t00              = real2d( "t00                "      , nzm, ncrms);
@@ -669,6 +670,8 @@ void finalize() {
 
   yakl::fence();
 
+  workspace::finalize();
+
   pressure_fftx.cleanup();
   pressure_ffty.cleanup();
   vt_fftx.cleanup();
@@ -118,6 +118,21 @@ class FPE(TestProperty):
             on_by_default=(tas is not None and not tas._machine.uses_gpu())
         )
 
+###############################################################################
+class MPP(TestProperty):
+###############################################################################
+
+    def __init__(self, tas):
+        TestProperty.__init__(
+            self,
+            "debug_mixed_precision_physics",
+            "debug with single precision versions of selected physics",
+            [("CMAKE_BUILD_TYPE", "Debug"), ("EKAT_DEFAULT_BFB", "True"),
+             ("EAMXX_ENABLE_MIXED_PRECISION_PHYSICS", "True")],
+            uses_baselines=False,
+            on_by_default=(tas is not None and not tas._machine.uses_gpu())
+        )
+
 ###############################################################################
 class OPT(TestProperty):
 ###############################################################################
@@ -12,6 +12,7 @@
 #include "share/util/eamxx_timing.hpp"
 #include "share/util/eamxx_utils.hpp"
 #include "share/io/eamxx_io_utils.hpp"
+#include "share/grid/remap/horiz_interp_remapper_data.hpp"
 #include "share/property_checks/mass_and_energy_column_conservation_check.hpp"
 
 #include "ekat/ekat_assert.hpp"
@@ -128,6 +129,10 @@ set_params(const ekat::ParameterList& atm_params)
 
   create_logger ();
 
+  // Optional cache of the horiz remap data built from map files
+  const auto& cache_dir = m_atm_params.sublist("scorpio").get<std::string>("horiz_remap_cache_dir","NONE");
+  HorizRemapperData::set_cache_dir(cache_dir=="NONE" ? "" : cache_dir);
+
   m_ad_status |= s_params_set;
 }
 
@@ -782,13 +787,16 @@ void AtmosphereDriver::initialize_output_managers () {
     }
   }
 
-  // Setup output managers
+  // Setup output managers. Diagnostics requested by multiple output
+  // managers are created (and computed) only once.
+  m_output_diag_registry = std::make_shared<OutputDiagRegistry>();
   for (auto& om : m_output_managers) {
     EKAT_REQUIRE_MSG(not om.is_restart(),
                      "Error! No restart output should be in m_output_managers. Model restart "
                      "output should be setup in m_restart_output_manager./n");
 
     om.set_logger(m_atm_logger);
+    om.set_diag_registry(m_output_diag_registry);
     om.setup(m_field_mgr,m_grids_manager->get_grid_names());
   }
 
@@ -1606,6 +1614,78 @@ initialize (const ekat::Comm& atm_comm,
   initialize_output_managers ();
 }
 
+void AtmosphereDriver::
+reset_state (const util::TimeStamp& run_t0,
+             const ekat::ParameterList& ic_params)
+{
+  check_ad_status (s_procs_inited);
+
+  m_atm_logger->info("[EAMxx] reset_state ...");
+  m_atm_logger->flush(); // During init, flush often (to help debug crashes)
+  start_timer("EAMxx::init");
+  start_timer("EAMxx::reset_state");
+
+  EKAT_REQUIRE_MSG (not fvphyshack,
+      "Error! Cannot reset the model state when running with a PG2 physics grid,\n"
+      "       since the CGLL IC fields were removed after initialization.\n");
+  EKAT_REQUIRE_MSG (m_atm_process_group->supports_state_reset(),
+      "Error! Some atm processes do not support resetting their state.\n"
+      "       A new AtmosphereDriver must be created for each run.\n");
+
+  // Close all output files of the previous run
+  if (m_restart_output_manager) {
+    m_restart_output_manager->finalize();
+    m_restart_output_manager = nullptr;
+  }
+  for (auto& out_mgr : m_output_managers) {
+    out_mgr.finalize();
+  }
+  m_output_managers.clear();
+  m_output_diag_registry = nullptr;
+  m_ad_status &= ~(s_output_created | s_output_inited);
+
+  // Reset to an initial run (case and run t0 coincide)
+  m_branch_run = false;
+  init_time_stamps (run_t0, run_t0, 0);
+  rewind_fields_time_stamps ();
+
+  // Load the new ICs, reusing grids, fields, and scorpio decompositions
+  m_atm_params.sublist("initial_conditions").import(ic_params);
+  m_fields_inited.clear();
+  set_initial_conditions ();
+
+  m_atm_process_group->reset_state(m_current_ts);
+
+  reset_accumulated_fields();
+
+  create_output_managers ();
+  initialize_output_managers ();
+
+  stop_timer("EAMxx::reset_state");
+  stop_timer("EAMxx::init");
+  m_atm_logger->info("[EAMxx] reset_state ... done!");
+  m_atm_logger->flush();
+}
+
+void AtmosphereDriver::rewind_fields_time_stamps ()
+{
+  // Time stamps cannot be moved backward, so invalidate them first, and then set
+  // them to the new start time. Fields that were never inited stay invalid.
+  std::vector<Field> valid_fields;
+  for (const auto& gn : m_grids_manager->get_grid_names()) {
+    for (const auto& it : m_field_mgr->get_repo(gn)) {
+      auto& track = it.second->get_header().get_tracking();
+      if (track.get_time_stamp().is_valid()) {
+        valid_fields.push_back(*it.second);
+        track.invalidate_time_stamp();
+      }
+    }
+  }
+  for (auto& f : valid_fields) {
+    f.get_header().get_tracking().update_time_stamp(m_current_ts);
+  }
+}
+
 void AtmosphereDriver::run (const int dt) {
   start_timer("EAMxx::run");
 
@@ -1704,6 +1784,7 @@ void AtmosphereDriver::finalize ( /* inputs? */ ) {
     out_mgr.finalize();
   }
   m_output_managers.clear();
+  m_output_diag_registry = nullptr;
 
   // Finalize, and then destroy all atmosphere processes
   if (m_atm_process_group.get()) {
@@ -151,6 +151,18 @@ public:
     initialize(atm_comm,params,t0,t0);
   }
 
+  // Reset the model state, and start a new initial run at run_t0, reusing grids,
+  // fields, remappers, and all the atm procs data structures (tables, buffers,...).
+  // This is useful to run many short simulations (e.g., ensemble members) on
+  // the same grid within one process, without paying the full init cost each time.
+  //  - ic_params: entries overriding those in the 'initial_conditions' sublist
+  //               (e.g., a new IC filename, or a new perturbation_random_seed)
+  // NOTE: fields that are not set by the ICs keep their current values.
+  // NOTE: output streams are closed and re-opened. Unless run_t0 changes, the
+  //       caller must change their filename_prefix to avoid overwriting files.
+  void reset_state (const util::TimeStamp& run_t0,
+                    const ekat::ParameterList& ic_params = ekat::ParameterList());
+
   // The run method is responsible for advancing the atmosphere component by one atm time step
   // Inside here you should find calls to the run method of each subcomponent, including parameterizations
   // and dynamics (HOMME).
@@ -184,6 +196,7 @@ protected:
   void create_logger ();
   void set_initial_conditions ();
   void restart_model ();
+  void rewind_fields_time_stamps ();
 
   // Read fields from a file
   void read_fields_from_file (const std::vector<Field>& fields,
@@ -202,6 +215,9 @@ protected:
   std::shared_ptr<OutputManager>            m_restart_output_manager;
   std::list<OutputManager>                  m_output_managers;
 
+  // Diagnostics requested in output, shared by all output managers
+  std::shared_ptr<OutputDiagRegistry>       m_output_diag_registry;
+
   std::shared_ptr<ATMBufferManager>         m_memory_buffer;
   std::shared_ptr<SCDataManager>            m_surface_coupling_import_data_manager;
   std::shared_ptr<SCDataManager>            m_surface_coupling_export_data_manager;
@@ -61,6 +61,9 @@ public:
   // The name of the subcomponent
   std::string name () const { return "SurfaceCouplingExporter"; }
 
+  // The time interpolation of exports from file can only move forward in time
+  bool supports_state_reset () const { return m_num_from_file_exports==0; }
+
   // Set the grid
   void set_grids (const std::shared_ptr<const GridsManager> grids_manager);
 
@@ -3,33 +3,6 @@
 #include "ekat/std_meta/ekat_std_utils.hpp"
 #include "ekat/util/ekat_units.hpp"
 
-namespace
-{
-// Find first position in array pointed by [beg,end) that is below z
-// If all z's in array are >=z, return end
-template<typename T>
-KOKKOS_INLINE_FUNCTION
-const T* find_first_smaller_z (const T* beg, const T* end, const T& z)
-{
-  // It's easier to find the last entry that is not smaller than z,
-  // and then we'll return the ptr after that
-  int count = end - beg;
-  while (count>1) {
-    auto mid = beg + count/2 - 1;
-    // if (z>=*mid) {
-    if (*mid>=z) {
-      beg = mid+1;
-    } else {
-      end = mid+1;
-    }
-    count = end - beg;
-  }
-
-  return *beg < z ? beg : end;
-}
-
-} // anonymous namespace
-
 namespace scream
 {
 
@@ -95,6 +68,8 @@ initialize_impl (const RunType /*run_type*/)
 
   // Figure out the z value
   m_z_suffix = tag==LEV ? "_mid" : "_int";
+  m_brackets = LevelBrackets::get(get_field_in(m_z_name + m_z_suffix),m_z,
+                                  LevelBrackets::Search::FirstSmaller);
 
   // All good, create the diag output
   FieldIdentifier d_fid (m_diag_name,layout.clone().strip_dim(tag),fid.get_units(),fid.get_grid_name());
@@ -115,10 +90,14 @@ initialize_impl (const RunType /*run_type*/)
 // =========================================================================================
 void FieldAtHeight::compute_diagnostic_impl()
 {
-  const auto z_view = get_field_in(m_z_name + m_z_suffix).get_view<const Real**>();
+  const auto& z = get_field_in(m_z_name + m_z_suffix);
+  const auto z_view = z.get_view<const Real**>();
   const Field& f = get_field_in(m_field_name);
   const auto& fl = f.get_header().get_identifier().get_layout();
 
+  // Position of the first z below z_tgt in each column (nlevs if none)
+  const auto positions = m_brackets->positions(z);
+
   using RangePolicy = typename KokkosTypes<DefaultDevice>::RangePolicy;
 
   auto z_tgt = m_z;
@@ -133,17 +112,14 @@ void FieldAtHeight::compute_diagnostic_impl()
         auto f_i = ekat::subview(f_view,i);
         auto z_i = ekat::subview(z_view,i);
 
-        auto beg = z_i.data();
-        auto end = beg+nlevs;
-        auto it = find_first_smaller_z(beg,end,z_tgt);
-        if (it==beg) {
+        auto pos = positions(i);
+        if (pos==0) {
           // We just extapolate with first entry
           d_view(i) = f_i(0);
-        } else if (it==end) {
+        } else if (pos==nlevs) {
           // We just extapolate with last entry
           d_view(i) = f_i(nlevs-1);
         } else {
-          auto pos = it-beg;
           auto z0 = z_i(pos-1);
           auto z1 = z_i(pos);
           auto f0 = f_i(pos-1);
@@ -166,17 +142,14 @@ void FieldAtHeight::compute_diagnostic_impl()
         auto f_ij = ekat::subview(f_view,i,j);
         auto z_i  = ekat::subview(z_view,i);
 
-        auto beg = z_i.data();
-        auto end = beg+nlevs;
-        auto it = find_first_smaller_z(beg,end,z_tgt);
-        if (it==beg) {
+        auto pos = positions(i);
+        if (pos==0) {
           // We just extapolate with first entry
           d_view(i,j) = f_ij(0);
-        } else if (it==end) {
+        } else if (pos==nlevs) {
           // We just extapolate with last entry
           d_view(i,j) = f_ij(nlevs-1);
         } else {
-          auto pos = it-beg;
           auto z0 = z_i(pos-1);
           auto z1 = z_i(pos);
           auto f0 = f_ij(pos-1);
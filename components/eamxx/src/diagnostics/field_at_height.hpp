@@ -2,6 +2,7 @@
 #define EAMXX_FIELD_AT_HEIGHT_HPP
 
 #include "share/atm_process/atmosphere_diagnostic.hpp"
+#include "diagnostics/field_at_level_brackets.hpp"
 
 namespace scream
 {
@@ -37,6 +38,9 @@ protected:
   std::string         m_field_name;
 
   Real                m_z;
+
+  // Shared with other diags slicing at the same height
+  std::shared_ptr<LevelBrackets>  m_brackets;
 };
 
 } //namespace scream
@@ -0,0 +1,104 @@
+#include "diagnostics/field_at_level_brackets.hpp"
+
+#include "ekat/util/ekat_upper_bound.hpp"
+
+#include <map>
+#include <sstream>
+
+namespace
+{
+// Find first position in array pointed by [beg,end) that is below z
+// If all z's in array are >=z, return end
+template<typename T>
+KOKKOS_INLINE_FUNCTION
+const T* find_first_smaller_z (const T* beg, const T* end, const T& z)
+{
+  // It's easier to find the last entry that is not smaller than z,
+  // and then we'll return the ptr after that
+  int count = end - beg;
+  while (count>1) {
+    auto mid = beg + count/2 - 1;
+    // if (z>=*mid) {
+    if (*mid>=z) {
+      beg = mid+1;
+    } else {
+      end = mid+1;
+    }
+    count = end - beg;
+  }
+
+  return *beg < z ? beg : end;
+}
+
+} // anonymous namespace
+
+namespace scream
+{
+
+std::shared_ptr<LevelBrackets> LevelBrackets::
+get (const Field& coord, const Real tgt, const Search search)
+{
+  // Only hold weak ptrs, so that brackets are released with the last diag using them
+  static std::map<std::string,std::weak_ptr<LevelBrackets>> s_brackets;
+
+  std::ostringstream key;
+  key << coord.name() << "@" << coord.get_header().get_identifier().get_grid_name()
+      << (search==Search::UpperBound ? ":ub:" : ":fs:") << std::hexfloat << tgt;
+
+  auto& ptr = s_brackets[key.str()];
+  auto brackets = ptr.lock();
+  if (brackets==nullptr) {
+    brackets = std::make_shared<LevelBrackets>(tgt,search);
+    ptr = brackets;
+  }
+  return brackets;
+}
+
+auto LevelBrackets::positions (const Field& coord)
+ -> const view_1d&
+{
+  const auto& ts = coord.get_header().get_tracking().get_time_stamp();
+  const void* data = coord.get_view<const Real**>().data();
+  if (not ts.is_valid() or ts!=m_ts or data!=m_data) {
+    compute_positions(coord);
+    m_ts = ts;
+    m_data = data;
+  }
+  return m_pos;
+}
+
+void LevelBrackets::compute_positions (const Field& coord)
+{
+  const auto& layout = coord.get_header().get_identifier().get_layout();
+  const int ncols = layout.dim(0);
+  const int nlevs = layout.dim(1);
+  if (m_pos.extent_int(0)!=ncols) {
+    m_pos = view_1d("level brackets",ncols);
+  }
+
+  const auto x = coord.get_view<const Real**>();
+  const auto pos = m_pos;
+  const auto tgt = m_tgt;
+  using RangePolicy = typename KokkosTypes<DefaultDevice>::RangePolicy;
+  RangePolicy policy (0,ncols);
+  if (m_search==Search::UpperBound) {
+    Kokkos::parallel_for(policy,KOKKOS_LAMBDA(const int icol) {
+      auto beg = &x(icol,0);
+      auto end = beg + nlevs;
+      auto last = beg + (nlevs-1);
+      if (tgt<*beg or tgt>*last) {
+        pos(icol) = -1;
+      } else {
+        pos(icol) = ekat::upper_bound(beg,end,tgt) - beg;
+      }
+    });
+  } else {
+    Kokkos::parallel_for(policy,KOKKOS_LAMBDA(const int icol) {
+      auto beg = &x(icol,0);
+      auto end = beg + nlevs;
+      pos(icol) = find_first_smaller_z(beg,end,tgt) - beg;
+    });
+  }
+}
+
+} //namespace scream
@@ -0,0 +1,65 @@
+#ifndef EAMXX_FIELD_AT_LEVEL_BRACKETS_HPP
+#define EAMXX_FIELD_AT_LEVEL_BRACKETS_HPP
+
+#include "share/field/field.hpp"
+#include "share/util/eamxx_time_stamp.hpp"
+
+#include <memory>
+#include <string>
+
+namespace scream
+{
+
+/*
+ * Position of a target value within the vertical profile of a coordinate
+ * field (e.g., p_mid or z_int), in each column.
+ *
+ * All the diagnostics slicing fields at the same value of the same coordinate
+ * (e.g., U, V, T, RH at 500hPa) share one instance, so that the search along
+ * the column is done once per update of the coordinate field, rather than
+ * once per diagnostic (and, for vector fields, per component).
+ */
+
+class LevelBrackets
+{
+public:
+  enum class Search {
+    UpperBound,   // First k such that coord(k)>tgt, for increasing coord (e.g., pressure).
+                  // If tgt is outside [coord(0),coord(nlevs-1)], the position is -1.
+    FirstSmaller  // First k such that coord(k)<tgt, for decreasing coord (e.g., height).
+                  // If coord(k)>=tgt for all k, the position is nlevs.
+  };
+
+  using view_1d = KokkosTypes<DefaultDevice>::view_1d<int>;
+
+  // Get the instance for the given coordinate field and target value,
+  // creating it if no other diagnostic is using it.
+  static std::shared_ptr<LevelBrackets>
+  get (const Field& coord, const Real tgt, const Search search);
+
+  // Positions of the target in each column of coord. They are recomputed only
+  // if coord was updated (or is a different field) since the last call.
+  const view_1d& positions (const Field& coord);
+
+  LevelBrackets (const Real tgt, const Search search)
+   : m_tgt(tgt), m_search(search) {}
+
+protected:
+#ifdef KOKKOS_ENABLE_CUDA
+public:
+#endif
+  void compute_positions (const Field& coord);
+protected:
+
+  Real            m_tgt;
+  Search          m_search;
+  view_1d         m_pos;
+
+  // Identify the coord values used to compute m_pos
+  util::TimeStamp m_ts;
+  const void*     m_data = nullptr;
+};
+
+} //namespace scream
+
+#endif // EAMXX_FIELD_AT_LEVEL_BRACKETS_HPP
@@ -2,7 +2,6 @@
 #include "share/util/eamxx_universal_constants.hpp"
 
 #include "ekat/std_meta/ekat_std_utils.hpp"
-#include "ekat/util/ekat_upper_bound.hpp"
 #include "ekat/util/ekat_units.hpp"
 
 namespace scream
@@ -72,6 +71,8 @@ initialize_impl (const RunType /*run_type*/)
 
   m_pressure_name = tag==LEV ? "p_mid" : "p_int";
   m_num_levs = layout.dims().back();
+  m_brackets = LevelBrackets::get(get_field_in(m_pressure_name),m_pressure_level,
+                                  LevelBrackets::Search::UpperBound);
   auto num_cols = layout.dims().front();
 
   // Take care of mask tracking for this field, in case it is needed.  This has two steps:
@@ -125,6 +126,9 @@ void FieldAtPressureLevel::compute_diagnostic_impl()
   const int ncols = pl.dim(0);
   const int nlevs = pl.dim(1);
 
+  // Position of p_tgt in each column (-1 if out of bounds)
+  const auto pos = m_brackets->positions(p_src);
+
   auto p_tgt = m_pressure_level;
   auto mval = m_mask_val;
   if (rank==2) {
@@ -135,15 +139,11 @@ void FieldAtPressureLevel::compute_diagnostic_impl()
     Kokkos::parallel_for(policy,KOKKOS_LAMBDA(const int icol) {
       auto x1 = ekat::subview(p_src_v,icol);
       auto y1 = ekat::subview(f_v,icol);
-      auto beg = x1.data();
-      auto end = beg + nlevs;
-      auto last = beg + (nlevs-1);
-      if (p_tgt<*beg or p_tgt>*last) {
+      const int k1 = pos(icol);
+      if (k1<0) {
         diag(icol) = mval;
         mask(icol) = 0;
       } else {
-        auto ub = ekat::upper_bound(beg,end,p_tgt);     
-        auto k1 = ub - beg;
         if (k1==0) {
           // Corner case: p_tgt==y1(0)
           diag(icol) = y1(0);
@@ -166,19 +166,12 @@ void FieldAtPressureLevel::compute_diagnostic_impl()
     Kokkos::parallel_for(policy,KOKKOS_LAMBDA(const MemberType& team) {
       int icol = team.league_rank();
       auto x1 = ekat::subview(p_src_v,icol);
-      auto beg = x1.data();
-      auto end = beg + nlevs;
-      auto last = beg + (nlevs-1);
+      const int k1 = pos(icol);
       Kokkos::parallel_for(Kokkos::TeamVectorRange(team,ndims),[&](const int idim) {
-        if (p_tgt<*beg or p_tgt>*last) {
+        if (k1<0) {
           diag(icol,idim) = mval;
-          Kokkos::single(Kokkos::PerTeam(team),[&]{
-            mask(icol) = 0;
-          });
         } else {
           auto y1 = ekat::subview(f_v,icol,idim);
-          auto ub = ekat::upper_bound(beg,end,p_tgt);     
-          auto k1 = ub - beg;
           if (k1==0) {
             // Corner case: p_tgt==y1(0)
             diag(icol,idim) = y1(0);
@@ -189,11 +182,11 @@ void FieldAtPressureLevel::compute_diagnostic_impl()
             // General case: interpolate between k1 and k1-1
             diag(icol,idim) = y1(k1-1) + (y1(k1)-y1(k1-1))/(x1(k1) - x1(k1-1)) * (p_tgt-x1(k1-1));
           }
-          Kokkos::single(Kokkos::PerTeam(team),[&]{
-            mask(icol) = 1;
-          });
         }
       });
+      Kokkos::single(Kokkos::PerTeam(team),[&]{
+        mask(icol) = k1<0 ? 0 : 1;
+      });
     });
   } else {
     EKAT_ERROR_MSG("Error! field at pressure level only supports fields ranks 2 and 3 \n");
@@ -2,6 +2,7 @@
 #define EAMXX_FIELD_AT_PRESSURE_LEVEL_HPP
 
 #include "share/atm_process/atmosphere_diagnostic.hpp"
+#include "diagnostics/field_at_level_brackets.hpp"
 
 #include <ekat/ekat_pack.hpp>
 
@@ -41,6 +42,9 @@ protected:
   int                 m_num_levs;
   Real                m_mask_val;
 
+  // Shared with other diags slicing at the same pressure level
+  std::shared_ptr<LevelBrackets>  m_brackets;
+
 }; // class FieldAtPressureLevel
 
 } //namespace scream
@@ -136,6 +136,29 @@ TEST_CASE("field_at_pressure_level_p2")
       }
     }
   } 
+  {
+    // Test 4: diags slicing at the same pressure level share the column search
+    Real plevel = std::round(pdf_pmid(engine));
+    auto diag1 = get_test_diag(comm, fm, gm, "mid", plevel);
+    auto diag2 = get_test_diag(comm, fm, gm, "mid", plevel);
+    diag1->initialize(t0,RunType::Initial);
+    diag2->initialize(t0,RunType::Initial);
+
+    const auto& p_mid = fm->get_field("p_mid");
+    auto brackets = LevelBrackets::get(p_mid,plevel,LevelBrackets::Search::UpperBound);
+    REQUIRE (brackets==LevelBrackets::get(p_mid,plevel,LevelBrackets::Search::UpperBound));
+    REQUIRE (brackets!=LevelBrackets::get(p_mid,plevel+1,LevelBrackets::Search::UpperBound));
+
+    for (auto diag : {diag1,diag2}) {
+      diag->compute_diagnostic();
+      auto diag_f = diag->get_diagnostic();
+      diag_f.sync_to_host();
+      auto diag_v = diag_f.get_view<const Real*, Host>();
+      for (int icol=0;icol<ncols;icol++) {
+        REQUIRE(approx(diag_v(icol),get_test_data(plevel)));
+      }
+    }
+  }
   
 } // TEST_CASE("field_at_pressure_level")
 /*==========================================================================================================*/
@@ -55,6 +55,9 @@ public:
   // The name of the subcomponent
   std::string name () const { return "homme"; }
 
+  // Homme keeps its own copy of the state, which can only be set up during init
+  bool supports_state_reset () const { return false; }
+
   // Set the grid
   void set_grids (const std::shared_ptr<const GridsManager> grids_manager);
 
@@ -25,6 +25,20 @@ struct Functions
   // ---------- GW constants ---------
   //
   struct GWC {
+    // Background diffusivity.
+    static constexpr ScalarT dback = 0.05;
+    // Minimum non-zero stress.
+    static constexpr ScalarT taumin = 1.e-10;
+    // Maximum allowed change in u-c (before efficiency applied).
+    static constexpr ScalarT umcfac = 0.5;
+    // Minimum value of (u-c)**2.
+    static constexpr ScalarT ubmc2mn = 0.01;
+
+    // Index the cardinal directions (0-based version of the fortran ones).
+    static constexpr int west  = 0;
+    static constexpr int east  = 1;
+    static constexpr int south = 2;
+    static constexpr int north = 3;
   };
 
   //
@@ -65,6 +79,60 @@ struct Functions
   using WorkspaceManager = typename ekat::WorkspaceManager<Spack, Device>;
   using Workspace        = typename WorkspaceManager::Workspace;
 
+  //
+  // ------- Init --------
+  //
+
+  // Parameters shared by the gw_common routines (see gw_common_init in gw_common.F90).
+  // Wave spectra (c, tau, gwut) are stored per column with the phase speed as the
+  // fastest (packed) index, i.e. tau(k, l+pgwv) for l in [-pgwv,pgwv], so that the
+  // loops over the spectrum are vectorized, and critical levels are handled with masks.
+  struct GwCommonInit {
+    // Number of levels in the atmosphere.
+    Int pver;
+    // Maximum number of waves allowed (i.e. wavenumbers are -pgwv:pgwv).
+    Int pgwv;
+    // Bin width for spectrum.
+    Scalar dc;
+    // Reference speeds for the spectrum (size 2*pgwv+1).
+    view_1d<const Scalar> cref;
+    // Preserves answers for vanilla CAM when only orographic waves are on.
+    bool orographic_only;
+    // Whether or not molecular diffusion is being done, and bottom level where it is done.
+    bool do_molec_diff;
+    Int nbot_molec;
+    // Whether or not to enforce an upper boundary condition of tau = 0.
+    bool tau_0_ubc;
+    // Interface levels for gravity wave sources.
+    Int ktop;
+    Int kbotbg;
+    // Critical Froude number, and effective horizontal wave number.
+    Scalar fcrit2;
+    Scalar kwv;
+    // Newtonian cooling coefficients (size pver+1).
+    view_1d<const Scalar> alpha;
+
+    // Derived quantities
+    Scalar effkwv;  // kwv*fcrit2
+    Scalar rog;     // rair/gravit
+    Scalar tndmax;  // Maximum wind tendency from stress divergence (before efficiency applied).
+  };
+
+  static GwCommonInit gw_common_init(
+    const Int& pver,
+    const Int& pgwv,
+    const Scalar& dc,
+    const view_1d<const Scalar>& cref,
+    const bool& orographic_only,
+    const bool& do_molec_diff,
+    const bool& tau_0_ubc,
+    const Int& nbot_molec,
+    const Int& ktop,
+    const Int& kbotbg,
+    const Scalar& fcrit2,
+    const Scalar& kwv,
+    const view_1d<const Scalar>& alpha);
+
   //
   // --------- Functions ---------
   //
@@ -72,29 +140,28 @@ struct Functions
   KOKKOS_FUNCTION
   static void gwd_compute_tendencies_from_stress_divergence(
     // Inputs
-    const Int& ncol,
-    const Int& pver,
-    const Int& pgwv,
+    const MemberType& team,
+    const GwCommonInit& init,
     const Int& ngwv,
     const bool& do_taper,
-    const Spack& dt,
-    const Spack& effgw,
-    const uview_1d<const Int>& tend_level,
-    const uview_1d<const Spack>& lat,
-    const uview_1d<const Spack>& dpm,
-    const uview_1d<const Spack>& rdpm,
+    const Scalar& dt,
+    const Scalar& effgw,
+    const Int& tend_level,
+    const Scalar& lat,
+    const uview_1d<const Scalar>& dpm,
+    const uview_1d<const Scalar>& rdpm,
     const uview_1d<const Spack>& c,
-    const uview_1d<const Spack>& ubm,
-    const uview_1d<const Spack>& t,
-    const uview_1d<const Spack>& nm,
-    const uview_1d<const Spack>& xv,
-    const uview_1d<const Spack>& yv,
+    const uview_1d<const Scalar>& ubm,
+    const uview_1d<const Scalar>& t,
+    const uview_1d<const Scalar>& nm,
+    const Scalar& xv,
+    const Scalar& yv,
     // Inputs/Outputs
-    const uview_1d<Spack>& tau,
+    const uview_2d<Spack>& tau,
     // Outputs
-    const uview_1d<Spack>& gwut,
-    const uview_1d<Spack>& utgw,
-    const uview_1d<Spack>& vtgw);
+    const uview_2d<Spack>& gwut,
+    const uview_1d<Scalar>& utgw,
+    const uview_1d<Scalar>& vtgw);
 
   KOKKOS_FUNCTION
   static void gw_prof(
@@ -134,37 +201,35 @@ struct Functions
   KOKKOS_FUNCTION
   static void gwd_compute_stress_profiles_and_diffusivities(
     // Inputs
-    const Int& pver,
-    const Int& pgwv,
-    const Int& ncol,
+    const MemberType& team,
+    const GwCommonInit& init,
     const Int& ngwv,
-    const uview_1d<const Int>& src_level,
-    const uview_1d<const Spack>& ubi,
+    const Int& src_level,
+    const uview_1d<const Scalar>& ubi,
     const uview_1d<const Spack>& c,
-    const uview_1d<const Spack>& rhoi,
-    const uview_1d<const Spack>& ni,
-    const uview_1d<const Spack>& kvtt,
-    const uview_1d<const Spack>& t,
-    const uview_1d<const Spack>& ti,
-    const uview_1d<const Spack>& piln,
+    const uview_1d<const Scalar>& rhoi,
+    const uview_1d<const Scalar>& ni,
+    const uview_1d<const Scalar>& kvtt,
+    const uview_1d<const Scalar>& t,
+    const uview_1d<const Scalar>& ti,
+    const uview_1d<const Scalar>& piln,
     // Inputs/Outputs
-    const uview_1d<Spack>& tau);
+    const uview_2d<Spack>& tau);
 
   KOKKOS_FUNCTION
   static void gwd_project_tau(
     // Inputs
-    const Int& pver,
-    const Int& pgwv,
-    const Int& ncol,
+    const MemberType& team,
+    const GwCommonInit& init,
     const Int& ngwv,
-    const uview_1d<const Int>& tend_level,
-    const uview_1d<const Spack>& tau,
-    const uview_1d<const Spack>& ubi,
+    const Int& tend_level,
+    const uview_2d<const Spack>& tau,
+    const uview_1d<const Scalar>& ubi,
     const uview_1d<const Spack>& c,
-    const uview_1d<const Spack>& xv,
-    const uview_1d<const Spack>& yv,
+    const Scalar& xv,
+    const Scalar& yv,
     // Outputs
-    const uview_1d<Spack>& taucd);
+    const uview_2d<Scalar>& taucd);
 
   KOKKOS_FUNCTION
   static void gwd_precalc_rhoi(
@@ -436,6 +501,24 @@ struct Functions
     const uview_1d<Spack>& xv,
     const uview_1d<Spack>& yv,
     const uview_1d<Spack>& c);
+  //
+  // --------- Helpers ---------
+  //
+
+  // Fortran's sign(a,b): |a| with the sign of b
+  KOKKOS_INLINE_FUNCTION
+  static Spack sign (const Spack& a, const Spack& b) {
+    Spack s = ekat::abs(a);
+    s.set(b < 0, -s);
+    return s;
+  }
+
+  // Mask of the waves in [-ngwv,ngwv], for the pack p of a spectrum with pgwv waves per side
+  KOKKOS_INLINE_FUNCTION
+  static Smask wave_mask (const Int& p, const Int& pgwv, const Int& ngwv) {
+    const auto l = ekat::range<IntSmallPack>(p*Spack::n) - pgwv;
+    return l >= -ngwv && l <= ngwv;
+  }
 }; // struct Functions
 
 } // namespace gw
@@ -445,6 +528,7 @@ struct Functions
 // to the translation unit; otherwise, ETI is used.
 #if defined(EAMXX_ENABLE_GPU) && !defined(KOKKOS_ENABLE_CUDA_RELOCATABLE_DEVICE_CODE) \
                                 && !defined(KOKKOS_ENABLE_HIP_RELOCATABLE_DEVICE_CODE)
+# include "impl/gw_gw_common_init_impl.hpp"
 # include "impl/gw_gwd_compute_tendencies_from_stress_divergence_impl.hpp"
 # include "impl/gw_gw_prof_impl.hpp"
 # include "impl/gw_momentum_energy_conservation_impl.hpp"
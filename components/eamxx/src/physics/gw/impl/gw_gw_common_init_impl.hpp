@@ -0,0 +1,73 @@
+#ifndef GW_GW_COMMON_INIT_IMPL_HPP
+#define GW_GW_COMMON_INIT_IMPL_HPP
+
+#include "gw_functions.hpp" // for ETI only but harmless for GPU
+
+namespace scream {
+namespace gw {
+
+/*
+ * Implementation of gw gw_common_init. Clients should NOT
+ * #include this file, but include gw_functions.hpp instead.
+ */
+
+template<typename S, typename D>
+typename Functions<S,D>::GwCommonInit
+Functions<S,D>::gw_common_init(
+// Inputs
+const Int& pver,
+const Int& pgwv,
+const Scalar& dc,
+const view_1d<const Scalar>& cref,
+const bool& orographic_only,
+const bool& do_molec_diff,
+const bool& tau_0_ubc,
+const Int& nbot_molec,
+const Int& ktop,
+const Int& kbotbg,
+const Scalar& fcrit2,
+const Scalar& kwv,
+const view_1d<const Scalar>& alpha)
+{
+  EKAT_REQUIRE_MSG (static_cast<Int>(cref.size())==2*pgwv+1,
+      "Error! Wrong size for the gw reference phase speeds.\n"
+      " - expected: " + std::to_string(2*pgwv+1) + "\n"
+      " - actual  : " + std::to_string(cref.size()) + "\n");
+  EKAT_REQUIRE_MSG (static_cast<Int>(alpha.size())==pver+1,
+      "Error! Wrong size for the gw Newtonian cooling coefficients.\n"
+      " - expected: " + std::to_string(pver+1) + "\n"
+      " - actual  : " + std::to_string(alpha.size()) + "\n");
+
+  GwCommonInit init;
+  init.pver = pver;
+  init.pgwv = pgwv;
+  init.dc = dc;
+  init.cref = cref;
+  init.orographic_only = orographic_only;
+  init.do_molec_diff = do_molec_diff;
+  init.tau_0_ubc = tau_0_ubc;
+  init.nbot_molec = nbot_molec;
+  init.ktop = ktop;
+  init.kbotbg = kbotbg;
+  init.fcrit2 = fcrit2;
+  init.kwv = kwv;
+  init.alpha = alpha;
+
+  init.effkwv = kwv * fcrit2;
+  init.rog = C::Rair / C::gravit;
+
+  if (not orographic_only) {
+    // 400 m/s/day
+    init.tndmax = 400. / 86400.;
+  } else {
+    // 500 m/s/day
+    init.tndmax = 500. / 86400.;
+  }
+
+  return init;
+}
+
+} // namespace gw
+} // namespace scream
+
+#endif
@@ -15,24 +15,96 @@ template<typename S, typename D>
 KOKKOS_FUNCTION
 void Functions<S,D>::gwd_compute_stress_profiles_and_diffusivities(
 // Inputs
-const Int& pver,
-const Int& pgwv,
-const Int& ncol,
+const MemberType& team,
+const GwCommonInit& init,
 const Int& ngwv,
-const uview_1d<const Int>& src_level,
-const uview_1d<const Spack>& ubi,
+const Int& src_level,
+const uview_1d<const Scalar>& ubi,
 const uview_1d<const Spack>& c,
-const uview_1d<const Spack>& rhoi,
-const uview_1d<const Spack>& ni,
-const uview_1d<const Spack>& kvtt,
-const uview_1d<const Spack>& t,
-const uview_1d<const Spack>& ti,
-const uview_1d<const Spack>& piln,
+const uview_1d<const Scalar>& rhoi,
+const uview_1d<const Scalar>& ni,
+const uview_1d<const Scalar>& kvtt,
+const uview_1d<const Scalar>& t,
+const uview_1d<const Scalar>& ti,
+const uview_1d<const Scalar>& piln,
 // Inputs/Outputs
-const uview_1d<Spack>& tau)
+const uview_2d<Spack>& tau)
 {
-  // TODO
-  // Note, argument types may need tweaking. Generator is not always able to tell what needs to be packed
+  // The waves are packed, so each pack holds several consecutive phase speeds,
+  // and critical levels are handled with masks rather than per-wave branches.
+  const Int npack = ekat::npack<Spack>(2*init.pgwv + 1);
+  const Scalar effkwv = init.effkwv;
+  const Scalar rog = init.rog;
+
+  // Loop from bottom to top to get stress profiles.
+  for (Int k = src_level-1; k >= init.ktop; --k) {
+
+    // Determine the absolute value of the saturation stress.
+    // Define critical levels where the sign of (u-c) changes between
+    // interfaces. These are cheap, so they are recomputed where needed,
+    // rather than stored for all waves.
+    const auto saturation_stress = [&] (const Int p, Spack& ubmc, Spack& tausat) {
+      ubmc = ubi(k) - c(p);
+
+      // Test to see if u-c has the same sign here as the level below.
+      const auto no_crit = ubmc * (ubi(k+1) - c(p)) > 0;
+      tausat = 0;
+      tausat.set(no_crit, ekat::abs(effkwv * rhoi(k) * ekat::cube(ubmc) / (2*ni(k))));
+      tausat.set(tausat <= GWC::taumin, 0);
+    };
+
+    // Determine the diffusivity for each column.
+    Scalar d = GWC::dback;
+    if (init.do_molec_diff) {
+      d += kvtt(k);
+    } else {
+      Scalar dmax;
+      Kokkos::parallel_reduce(Kokkos::TeamVectorRange(team, npack), [&] (const Int p, Scalar& lmax) {
+        Spack ubmc, tausat;
+        saturation_stress(p, ubmc, tausat);
+
+        const auto dsat = ekat::square(ubmc / ni(k)) *
+          (effkwv * ekat::square(ubmc) / (rog * ti(k) * ni(k)) - init.alpha(k));
+        const auto dscal = ekat::min(Spack(1), tau(k+1,p) / (tausat + GWC::taumin));
+        const Spack dd = dscal * dsat;
+
+        const auto active = wave_mask(p, init.pgwv, ngwv);
+        for (int s = 0; s < Spack::n; ++s) {
+          if (active[s] && dd[s] > lmax) lmax = dd[s];
+        }
+      }, Kokkos::Max<Scalar>(dmax));
+      if (dmax > d) d = dmax;
+    }
+
+    // Compute stress for each wave. The stress at this level is the min of
+    // the saturation stress and the stress at the level below reduced by
+    // damping. The sign of the stress must be the same as at the level
+    // below.
+
+    // If molecular diffusion is on, only do this in levels with molecular
+    // diffusion. Otherwise, do it everywhere.
+    const bool damp = k <= init.nbot_molec || !init.do_molec_diff;
+    Kokkos::parallel_for(Kokkos::TeamVectorRange(team, npack), [&] (const Int p) {
+      Spack ubmc, tausat;
+      saturation_stress(p, ubmc, tausat);
+
+      const auto active = wave_mask(p, init.pgwv, ngwv);
+      if (damp) {
+        const auto ubmc2 = ekat::max(ekat::square(ubmc), GWC::ubmc2mn);
+        const auto mi = ni(k) / (2 * init.kwv * ubmc2) *
+          (init.alpha(k) + ekat::square(ni(k)) / ubmc2 * d);
+        const auto wrk = -2 * mi * rog * t(k) * (piln(k+1) - piln(k));
+
+        Spack taudmp(0);
+        taudmp.set(wrk >= -150 || !init.do_molec_diff, tau(k+1,p) * ekat::exp(wrk));
+        taudmp.set(taudmp <= GWC::taumin, 0);
+        tau(k,p).set(active, ekat::min(taudmp, tausat));
+      } else {
+        tau(k,p).set(active, ekat::min(tau(k+1,p), tausat));
+      }
+    });
+    team.team_barrier();
+  }
 }
 
 } // namespace gw
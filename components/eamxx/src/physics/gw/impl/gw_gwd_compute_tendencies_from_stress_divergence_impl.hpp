@@ -14,33 +14,116 @@ namespace gw {
 template<typename S, typename D>
 KOKKOS_FUNCTION
 void Functions<S,D>::gwd_compute_tendencies_from_stress_divergence(
-  // Inputs
-  const Int& ncol,
-  const Int& pver,
-  const Int& pgwv,
-  const Int& ngwv,
-  const bool& do_taper,
-  const Spack& dt,
-  const Spack& effgw,
-  const uview_1d<const Int>& tend_level,
-  const uview_1d<const Spack>& lat,
-  const uview_1d<const Spack>& dpm,
-  const uview_1d<const Spack>& rdpm,
-  const uview_1d<const Spack>& c,
-  const uview_1d<const Spack>& ubm,
-  const uview_1d<const Spack>& t,
-  const uview_1d<const Spack>& nm,
-  const uview_1d<const Spack>& xv,
-  const uview_1d<const Spack>& yv,
-  // Inputs/Outputs
-  const uview_1d<Spack>& tau,
-  // Outputs
-  const uview_1d<Spack>& gwut,
-  const uview_1d<Spack>& utgw,
-  const uview_1d<Spack>& vtgw)
+// Inputs
+const MemberType& team,
+const GwCommonInit& init,
+const Int& ngwv,
+const bool& do_taper,
+const Scalar& dt,
+const Scalar& effgw,
+const Int& tend_level,
+const Scalar& lat,
+const uview_1d<const Scalar>& dpm,
+const uview_1d<const Scalar>& rdpm,
+const uview_1d<const Spack>& c,
+const uview_1d<const Scalar>& ubm,
+const uview_1d<const Scalar>& t,
+const uview_1d<const Scalar>& nm,
+const Scalar& xv,
+const Scalar& yv,
+// Inputs/Outputs
+const uview_2d<Spack>& tau,
+// Outputs
+const uview_2d<Spack>& gwut,
+const uview_1d<Scalar>& utgw,
+const uview_1d<Scalar>& vtgw)
 {
-  // TODO
-  // Note, argument types may need tweaking. Generator is not always able to tell what needs to be packed
+  const Int npack = ekat::npack<Spack>(2*init.pgwv + 1);
+  const bool orographic_only = init.orographic_only;
+
+  // Polar taper.
+  const Scalar ptaper = do_taper ? Kokkos::cos(lat) : 1;
+
+  // Force tau at the top of the model to zero, if requested.
+  if (init.tau_0_ubc) {
+    Kokkos::parallel_for(Kokkos::TeamVectorRange(team, npack), [&] (const Int p) {
+      tau(0,p) = 0;
+    });
+    team.team_barrier();
+  }
+
+  // Loop over levels from top to bottom. Interfaces are indexed 0:pver, and
+  // midpoints 0:pver-1, so midpoint k-1 lies between interfaces k-1 and k.
+  for (Int k = init.ktop+1; k <= tend_level; ++k) {
+    const Int km = k-1;
+
+    Kokkos::parallel_for(Kokkos::TeamVectorRange(team, npack), [&] (const Int p) {
+      const auto active = wave_mask(p, init.pgwv, ngwv);
+
+      // Determine the wind tendency, including excess stress carried down
+      // from above.
+      Spack ubtl = C::gravit * (tau(k,p) - tau(k-1,p)) * rdpm(km);
+
+      if (orographic_only) {
+        // Require that the tendency be no larger than the analytic
+        // solution for a saturated region [proportional to (u-c)^3].
+        const auto ubtlsat = init.effkwv * ekat::abs(ekat::cube(c(p) - ubm(km))) /
+          (2 * init.rog * t(km) * nm(km));
+        ubtl = ekat::min(ubtl, ubtlsat);
+      }
+
+      // Apply tendency limits to maintain numerical stability.
+      // 1. du/dt < |c-u|/dt  so u-c cannot change sign
+      //    (u^n+1 = u^n + du/dt * dt)
+      // 2. du/dt < tndmax    so that ridicuously large tendencies are not
+      //    permitted
+      ubtl = ekat::min(ubtl, GWC::umcfac * ekat::abs(c(p) - ubm(km)) / dt);
+      ubtl = ekat::min(ubtl, init.tndmax);
+
+      // Save tendency for each wave (for later computation of kzz), applying
+      // efficiency and taper. In the orographic case, the mean tendency uses
+      // the unscaled values, so the scaling is applied after accumulating it.
+      const auto signed_ubtl = sign(ubtl, c(p) - ubm(km));
+      if (orographic_only) {
+        gwut(km,p).set(active, signed_ubtl);
+      } else {
+        gwut(km,p).set(active, signed_ubtl * effgw * ptaper);
+      }
+
+      // Redetermine the effective stress on the interface below from
+      // the wind tendency. If the wind tendency was limited above,
+      // then the new stress will be smaller than the old stress,
+      // causing stress divergence in the next layer down. This
+      // smoothes large stress divergences downward while conserving
+      // total stress.
+      tau(k,p).set(active, tau(k-1,p) + ubtl * dpm(km) / C::gravit);
+    });
+    team.team_barrier();
+
+    // Accumulate the mean wind tendency over wavenumber, in wave order, and
+    // project it onto the components.
+    Kokkos::single(Kokkos::PerTeam(team), [&] () {
+      Scalar ubt = 0;
+      for (Int p = 0; p < npack; ++p) {
+        const auto active = wave_mask(p, init.pgwv, ngwv);
+        for (int s = 0; s < Spack::n; ++s) {
+          if (active[s]) ubt += gwut(km,p)[s];
+        }
+        if (orographic_only) {
+          gwut(km,p).set(active, gwut(km,p) * effgw * ptaper);
+        }
+      }
+
+      if (!orographic_only) {
+        utgw(km) = ubt * xv;
+        vtgw(km) = ubt * yv;
+      } else {
+        utgw(km) = ubt * xv * effgw * ptaper;
+        vtgw(km) = ubt * yv * effgw * ptaper;
+      }
+    });
+    team.team_barrier();
+  }
 }
 
 } // namespace gw
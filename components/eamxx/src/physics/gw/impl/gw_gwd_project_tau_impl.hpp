@@ -15,21 +15,65 @@ template<typename S, typename D>
 KOKKOS_FUNCTION
 void Functions<S,D>::gwd_project_tau(
 // Inputs
-const Int& pver,
-const Int& pgwv,
-const Int& ncol,
+const MemberType& team,
+const GwCommonInit& init,
 const Int& ngwv,
-const uview_1d<const Int>& tend_level,
-const uview_1d<const Spack>& tau,
-const uview_1d<const Spack>& ubi,
+const Int& tend_level,
+const uview_2d<const Spack>& tau,
+const uview_1d<const Scalar>& ubi,
 const uview_1d<const Spack>& c,
-const uview_1d<const Spack>& xv,
-const uview_1d<const Spack>& yv,
+const Scalar& xv,
+const Scalar& yv,
 // Outputs
-const uview_1d<Spack>& taucd)
+const uview_2d<Scalar>& taucd)
 {
-  // TODO
-  // Note, argument types may need tweaking. Generator is not always able to tell what needs to be packed
+  // Tau projected in the four cardinal directions, for the momentum
+  // conservation routine and for diagnostic output.
+
+  const Int npack = ekat::npack<Spack>(2*init.pgwv + 1);
+
+  // ubi at tend_level.
+  const Scalar ubi_tend = ubi(tend_level);
+
+  // Levels are independent. Within a level, the sums over the spectrum are
+  // accumulated in wave order, to match the scalar loop.
+  Kokkos::parallel_for(Kokkos::TeamVectorRange(team, init.ktop, tend_level+1), [&] (const Int k) {
+    // Reynolds stress for waves propagating behind and forward of the wind.
+    Scalar taub = 0;
+    Scalar tauf = 0;
+
+    for (Int p = 0; p < npack; ++p) {
+      // Signed wave Reynolds stress.
+      const auto tausg = sign(tau(k,p), c(p) - ubi(k));
+
+      const auto active  = wave_mask(p, init.pgwv, ngwv);
+      const auto behind  = active && c(p) < ubi_tend;
+      const auto forward = active && c(p) > ubi_tend;
+      for (int s = 0; s < Spack::n; ++s) {
+        if (behind[s]) {
+          taub += tausg[s];
+        } else if (forward[s]) {
+          tauf += tausg[s];
+        }
+      }
+    }
+
+    if (xv > 0) {
+      taucd(k,GWC::east) = tauf * xv;
+      taucd(k,GWC::west) = taub * xv;
+    } else if (xv < 0) {
+      taucd(k,GWC::east) = taub * xv;
+      taucd(k,GWC::west) = tauf * xv;
+    }
+
+    if (yv > 0) {
+      taucd(k,GWC::north) = tauf * yv;
+      taucd(k,GWC::south) = taub * yv;
+    } else if (yv < 0) {
+      taucd(k,GWC::north) = taub * yv;
+      taucd(k,GWC::south) = tauf * yv;
+    }
+  });
 }
 
 } // namespace gw
@@ -0,0 +1,242 @@
+#include "gw_functions.hpp"
+
+#include "share/eamxx_types.hpp"
+#include "share/eamxx_session.hpp"
+#include "physics/share/physics_bench_utils.hpp"
+#include "physics/share/physics_constants.hpp"
+
+#include <ekat/kokkos/ekat_subview_utils.hpp>
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+
+namespace {
+using namespace scream;
+using namespace scream::gw;
+
+using GWFD       = Functions<Real, DefaultDevice>;
+using Spack      = typename GWFD::Spack;
+using KT         = typename GWFD::KT;
+using ExeSpace   = typename KT::ExeSpace;
+using MemberType = typename GWFD::MemberType;
+
+/*
+ * gw_bench times the gw_common kernels that propagate a wave spectrum through
+ * the column: the stress profiles, the projection of the stress onto the
+ * horizontal directions, and the tendencies from the stress divergence.
+ *
+ * Columns are synthetic: a stably stratified atmosphere, a sheared wind whose
+ * phase varies across columns (so critical levels differ from column to column),
+ * and a gaussian launch spectrum at the source level.
+ * The source routines (gw_beres_src, gw_cm_src, gw_oro_src) are not timed,
+ * since they are not ported to C++ yet.
+ */
+
+struct Columns {
+  KT::view_1d<Real> cref, alpha, xv, yv, lat;
+  KT::view_2d<Real> ubi, ubm, rhoi, ni, nm, kvtt, t, ti, piln, dpm, rdpm;
+  KT::view_2d<Spack> c;
+  KT::view_3d<Spack> tau0, tau, gwut;
+  KT::view_2d<Real> utgw, vtgw;
+  KT::view_3d<Real> taucd;
+};
+
+Columns make_columns (const int ncol, const int pver, const int pgwv, const Real dc) {
+  using C = scream::physics::Constants<Real>;
+  const int nwaves = 2*pgwv+1;
+  const int npack  = ekat::npack<Spack>(nwaves);
+  const int src    = pver - pver/8;
+
+  Columns s;
+  s.cref  = decltype(s.cref)("cref",nwaves);
+  s.alpha = decltype(s.alpha)("alpha",pver+1);
+  s.xv    = decltype(s.xv)("xv",ncol);
+  s.yv    = decltype(s.yv)("yv",ncol);
+  s.lat   = decltype(s.lat)("lat",ncol);
+  for (auto v : {&s.ubi, &s.rhoi, &s.ni, &s.kvtt, &s.ti, &s.piln}) {
+    *v = KT::view_2d<Real>("",ncol,pver+1);
+  }
+  for (auto v : {&s.ubm, &s.nm, &s.t, &s.dpm, &s.rdpm, &s.utgw, &s.vtgw}) {
+    *v = KT::view_2d<Real>("",ncol,pver);
+  }
+  s.c     = KT::view_2d<Spack>("c",ncol,npack);
+  s.tau0  = KT::view_3d<Spack>("tau0",ncol,pver+1,npack);
+  s.tau   = KT::view_3d<Spack>("tau",ncol,pver+1,npack);
+  s.gwut  = KT::view_3d<Spack>("gwut",ncol,pver,npack);
+  s.taucd = KT::view_3d<Real>("taucd",ncol,pver+1,4);
+
+  auto cref  = Kokkos::create_mirror_view(s.cref);
+  auto alpha = Kokkos::create_mirror_view(s.alpha);
+  for (int l = 0; l < nwaves; ++l) cref(l) = dc*(l-pgwv);
+  for (int k = 0; k <= pver; ++k) alpha(k) = 1e-6;
+  Kokkos::deep_copy(s.cref,cref);
+  Kokkos::deep_copy(s.alpha,alpha);
+
+  auto xv = Kokkos::create_mirror_view(s.xv);
+  auto yv = Kokkos::create_mirror_view(s.yv);
+  auto lat = Kokkos::create_mirror_view(s.lat);
+  auto ubi = Kokkos::create_mirror_view(s.ubi);
+  auto rhoi = Kokkos::create_mirror_view(s.rhoi);
+  auto ni = Kokkos::create_mirror_view(s.ni);
+  auto ti = Kokkos::create_mirror_view(s.ti);
+  auto piln = Kokkos::create_mirror_view(s.piln);
+  auto ubm = Kokkos::create_mirror_view(s.ubm);
+  auto nm = Kokkos::create_mirror_view(s.nm);
+  auto t = Kokkos::create_mirror_view(s.t);
+  auto dpm = Kokkos::create_mirror_view(s.dpm);
+  auto rdpm = Kokkos::create_mirror_view(s.rdpm);
+  auto c = Kokkos::create_mirror_view(s.c);
+  auto tau0 = Kokkos::create_mirror_view(s.tau0);
+  Kokkos::deep_copy(tau0,0);
+
+  const Real pi = M_PI;
+  for (int i = 0; i < ncol; ++i) {
+    const Real phase = 2*pi*i/ncol;
+    const Real angle = pi*(i % 8)/4;
+    xv(i) = std::cos(angle);
+    yv(i) = std::sin(angle);
+    lat(i) = pi*(Real(i)/ncol - 0.5);
+
+    auto pint = [&](int k) { return 100 + (1e5-100)*Real(k)/pver; };
+    for (int k = 0; k <= pver; ++k) {
+      ti(i,k)   = 200 + 90*Real(k)/pver;
+      piln(i,k) = std::log(pint(k));
+      rhoi(i,k) = pint(k) / (C::Rair*ti(i,k));
+      ni(i,k)   = 0.02;
+      ubi(i,k)  = 30*std::sin(2*pi*Real(k)/pver + phase);
+    }
+    for (int k = 0; k < pver; ++k) {
+      t(i,k)    = 0.5*(ti(i,k)+ti(i,k+1));
+      ubm(i,k)  = 0.5*(ubi(i,k)+ubi(i,k+1));
+      nm(i,k)   = 0.02;
+      dpm(i,k)  = pint(k+1)-pint(k);
+      rdpm(i,k) = 1/dpm(i,k);
+    }
+    for (int l = 0; l < nwaves; ++l) {
+      const Real cl = cref(l);
+      c(i,l/Spack::n)[l%Spack::n] = cl;
+      tau0(i,src,l/Spack::n)[l%Spack::n] = 1e-3*std::exp(-cl*cl/900);
+    }
+  }
+
+  Kokkos::deep_copy(s.xv,xv);
+  Kokkos::deep_copy(s.yv,yv);
+  Kokkos::deep_copy(s.lat,lat);
+  Kokkos::deep_copy(s.ubi,ubi);
+  Kokkos::deep_copy(s.rhoi,rhoi);
+  Kokkos::deep_copy(s.ni,ni);
+  Kokkos::deep_copy(s.ti,ti);
+  Kokkos::deep_copy(s.piln,piln);
+  Kokkos::deep_copy(s.ubm,ubm);
+  Kokkos::deep_copy(s.nm,nm);
+  Kokkos::deep_copy(s.t,t);
+  Kokkos::deep_copy(s.dpm,dpm);
+  Kokkos::deep_copy(s.rdpm,rdpm);
+  Kokkos::deep_copy(s.c,c);
+  Kokkos::deep_copy(s.tau0,tau0);
+  return s;
+}
+
+template<typename F>
+double time_kernel (const F& f) {
+  Kokkos::fence();
+  const auto start = std::chrono::steady_clock::now();
+  f();
+  Kokkos::fence();
+  return std::chrono::duration<double>(std::chrono::steady_clock::now()-start).count();
+}
+
+} // namespace anon
+
+int main (int argc, char** argv) {
+  if (argc > 1 && std::string(argv[1])=="-h") {
+    std::cout <<
+      argv[0] << " [options]\n"
+      "Options:\n" << bench::common_usage() <<
+      "  -pgwv <waves>       Number of waves on each side of 0 (2*pgwv+1 total). Default=32.\n"
+      "  -dt <seconds>       Length of timestep. Default=300.\n";
+    return 0;
+  }
+
+  int pgwv = 32;
+  Real dt = 300;
+  const auto cfg = bench::parse_args(argc, argv, [&](int& i) {
+    const std::string a = argv[i];
+    if (a=="-pgwv" || a=="--pgwv") {
+      bench::expect_another_arg(i, argc);
+      pgwv = std::atoi(argv[++i]);
+    } else if (a=="-dt" || a=="--dt") {
+      bench::expect_another_arg(i, argc);
+      dt = std::atof(argv[++i]);
+    }
+  });
+  EKAT_REQUIRE_MSG (cfg.nlev>=8 && pgwv>0, "Error! gw_bench needs nlev>=8 and pgwv>0.\n");
+
+  scream::initialize_eamxx_session(argc, argv);
+  {
+    const int ncol = cfg.ncol;
+    const int pver = cfg.nlev;
+    const int src  = pver - pver/8;
+    const Real dc  = 2.5;
+    const auto s = make_columns(ncol, pver, pgwv, dc);
+    const auto init = GWFD::gw_common_init(pver, pgwv, dc, s.cref, false, false, false,
+                                           0, 0, src, 1.0, 6.28e-5, s.alpha);
+    const int ngwv = pgwv;
+    const Real effgw = 0.1;
+
+    const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(ncol, s.c.extent(1));
+
+    bench::Timings timings;
+    for (int r = -cfg.nwarm; r < cfg.nrep; ++r) {
+      double t_stress = 0, t_proj = 0, t_tend = 0;
+      for (int it = 0; it < cfg.nsteps; ++it) {
+        Kokkos::deep_copy(s.tau, s.tau0);
+
+        t_stress += time_kernel([&]() {
+          Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
+            const int i = team.league_rank();
+            GWFD::gwd_compute_stress_profiles_and_diffusivities(
+              team, init, ngwv, src, ekat::subview(s.ubi,i), ekat::subview(s.c,i),
+              ekat::subview(s.rhoi,i), ekat::subview(s.ni,i), ekat::subview(s.kvtt,i),
+              ekat::subview(s.t,i), ekat::subview(s.ti,i), ekat::subview(s.piln,i),
+              Kokkos::subview(s.tau,i,Kokkos::ALL(),Kokkos::ALL()));
+          });
+        });
+
+        t_proj += time_kernel([&]() {
+          Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
+            const int i = team.league_rank();
+            GWFD::gwd_project_tau(
+              team, init, ngwv, src, Kokkos::subview(s.tau,i,Kokkos::ALL(),Kokkos::ALL()),
+              ekat::subview(s.ubi,i), ekat::subview(s.c,i), s.xv(i), s.yv(i),
+              Kokkos::subview(s.taucd,i,Kokkos::ALL(),Kokkos::ALL()));
+          });
+        });
+
+        t_tend += time_kernel([&]() {
+          Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
+            const int i = team.league_rank();
+            GWFD::gwd_compute_tendencies_from_stress_divergence(
+              team, init, ngwv, true, dt, effgw, src, s.lat(i),
+              ekat::subview(s.dpm,i), ekat::subview(s.rdpm,i), ekat::subview(s.c,i),
+              ekat::subview(s.ubm,i), ekat::subview(s.t,i), ekat::subview(s.nm,i),
+              s.xv(i), s.yv(i),
+              Kokkos::subview(s.tau,i,Kokkos::ALL(),Kokkos::ALL()),
+              Kokkos::subview(s.gwut,i,Kokkos::ALL(),Kokkos::ALL()),
+              ekat::subview(s.utgw,i), ekat::subview(s.vtgw,i));
+          });
+        });
+      }
+      if (r >= 0) {
+        timings.add("gwd_compute_stress_profiles", t_stress);
+        timings.add("gwd_project_tau", t_proj);
+        timings.add("gwd_compute_tendencies", t_tend);
+      }
+    }
+    timings.report("GW (pgwv=" + std::to_string(pgwv) + ")", cfg, SCREAM_SMALL_PACK_SIZE);
+  }
+  scream::finalize_eamxx_session();
+
+  return 0;
+}
@@ -5,6 +5,7 @@
 #include "ekat/ekat_pack_kokkos.hpp"
 #include "ekat/ekat_assert.hpp"
 
+#include <algorithm>
 #include <random>
 
 using scream::Real;
@@ -68,6 +69,101 @@ void gw_oro_src_c(Int ncol, Real* u, Real* v, Real* t, Real* sgh, Real* pmid, Re
 
 } // extern "C" : end _c decls
 
+namespace {
+
+using GWFD       = Functions<Real, DefaultDevice>;
+using Spack      = typename GWFD::Spack;
+using KTD        = typename GWFD::KT;
+using ExeSpace   = typename KTD::ExeSpace;
+using MemberType = typename GWFD::MemberType;
+
+template <typename S>
+using dview_1d = typename KTD::template view_1d<S>;
+template <typename S>
+using dview_2d = typename KTD::template view_2d<S>;
+template <typename S>
+using dview_3d = typename KTD::template view_3d<S>;
+
+// Build the C++ gw_common parameters from the same data used for the fortran init
+GWFD::GwCommonInit gw_common_init_cxx(const GwInit& init)
+{
+  dview_1d<Real> cref("cref", 2*init.pgwv + 1), alpha("alpha", init.pver + 1);
+  auto cref_h  = Kokkos::create_mirror_view(cref);
+  auto alpha_h = Kokkos::create_mirror_view(alpha);
+  std::copy(init.cref, init.cref + cref.size(), cref_h.data());
+  std::copy(init.alpha, init.alpha + alpha.size(), alpha_h.data());
+  Kokkos::deep_copy(cref, cref_h);
+  Kokkos::deep_copy(alpha, alpha_h);
+
+  return GWFD::gw_common_init(init.pver, init.pgwv, init.dc, cref, init.orographic_only,
+                              init.do_molec_diff, init.tau_0_ubc, init.nbot_molec,
+                              init.ktop, init.kbotbg, init.fcrit2, init.kwv, alpha);
+}
+
+// Copy a host array of size n to device
+template <typename S>
+dview_1d<S> to_device_1d(const std::string& name, const S* h, const Int n)
+{
+  dview_1d<S> d(name, n);
+  auto d_h = Kokkos::create_mirror_view(d);
+  std::copy(h, h + n, d_h.data());
+  Kokkos::deep_copy(d, d_h);
+  return d;
+}
+
+// Copy a host array of shape (n0,n1) to device, and back
+dview_2d<Real> to_device_2d(const std::string& name, const Real* h, const Int n0, const Int n1)
+{
+  dview_2d<Real> d(name, n0, n1);
+  auto d_h = Kokkos::create_mirror_view(d);
+  std::copy(h, h + n0*n1, d_h.data());
+  Kokkos::deep_copy(d, d_h);
+  return d;
+}
+
+void to_host_2d(const dview_2d<Real>& d, Real* h)
+{
+  auto d_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), d);
+  std::copy(d_h.data(), d_h.data() + d_h.size(), h);
+}
+
+// Spectrum arrays are stored on device as (ncol,nlev,npack(2*pgwv+1)), with the
+// waves as the packed (fastest) index. idx(i,k,j) gives the position of wave j
+// in the host array, or -1 if the host array does not store that wave.
+template <typename IdxF>
+dview_3d<Spack> spectrum_to_device(const std::string& name, const Real* h, const Int ncol,
+                                   const Int nlev, const Int nwaves, const IdxF& idx)
+{
+  dview_3d<Spack> d(name, ncol, nlev, ekat::npack<Spack>(nwaves));
+  auto d_h = Kokkos::create_mirror_view(d);
+  for (Int i = 0; i < ncol; ++i) {
+    for (Int k = 0; k < nlev; ++k) {
+      for (Int j = 0; j < nwaves; ++j) {
+        const Int n = idx(i, k, j);
+        if (n >= 0) d_h(i, k, j/Spack::n)[j%Spack::n] = h[n];
+      }
+    }
+  }
+  Kokkos::deep_copy(d, d_h);
+  return d;
+}
+
+template <typename IdxF>
+void spectrum_to_host(const dview_3d<Spack>& d, Real* h, const Int nwaves, const IdxF& idx)
+{
+  auto d_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), d);
+  for (Int i = 0; i < static_cast<Int>(d_h.extent(0)); ++i) {
+    for (Int k = 0; k < static_cast<Int>(d_h.extent(1)); ++k) {
+      for (Int j = 0; j < nwaves; ++j) {
+        const Int n = idx(i, k, j);
+        if (n >= 0) h[n] = d_h(i, k, j/Spack::n)[j%Spack::n];
+      }
+    }
+  }
+}
+
+} // anonymous namespace
+
 // Wrapper around gw_init
 void gw_init(GwInit& init)
 {
@@ -76,10 +172,54 @@ void gw_init(GwInit& init)
 
 void gwd_compute_tendencies_from_stress_divergence(GwdComputeTendenciesFromStressDivergenceData& d)
 {
-  gw_init(d.init);
-  d.transpose<ekat::TransposeDirection::c2f>();
-  gwd_compute_tendencies_from_stress_divergence_c(d.ncol, d.ngwv, d.do_taper, d.dt, d.effgw, d.tend_level, d.lat, d.dpm, d.rdpm, d.c, d.ubm, d.t, d.nm, d.xv, d.yv, d.tau, d.gwut, d.utgw, d.vtgw);
-  d.transpose<ekat::TransposeDirection::f2c>();
+  const auto init = gw_common_init_cxx(d.init);
+  const Int ncol = d.ncol, ngwv = d.ngwv, pver = d.init.pver, pgwv = d.init.pgwv;
+  const Int nwaves = 2*pgwv + 1;
+  const bool do_taper = d.do_taper;
+  const Real dt = d.dt, effgw = d.effgw;
+
+  // Host layouts: c(ncol,nwaves), tau(ncol,nwaves,pver+1), gwut(ncol,pver,2*ngwv+1)
+  const auto c_idx    = [&](Int i, Int, Int j) { return i*nwaves + j; };
+  const auto tau_idx  = [&](Int i, Int k, Int j) { return (i*nwaves + j)*(pver+1) + k; };
+  const auto gwut_idx = [&](Int i, Int k, Int j) {
+    const Int l = j - pgwv;
+    return (l < -ngwv || l > ngwv) ? -1 : (i*pver + k)*(2*ngwv+1) + l + ngwv;
+  };
+
+  const auto tend_level_d = to_device_1d("tend_level", d.tend_level, ncol);
+  const auto lat_d  = to_device_1d("lat", d.lat, ncol);
+  const auto xv_d   = to_device_1d("xv", d.xv, ncol);
+  const auto yv_d   = to_device_1d("yv", d.yv, ncol);
+  const auto dpm_d  = to_device_2d("dpm", d.dpm, ncol, pver);
+  const auto rdpm_d = to_device_2d("rdpm", d.rdpm, ncol, pver);
+  const auto ubm_d  = to_device_2d("ubm", d.ubm, ncol, pver);
+  const auto t_d    = to_device_2d("t", d.t, ncol, pver);
+  const auto nm_d   = to_device_2d("nm", d.nm, ncol, pver);
+  const auto utgw_d = to_device_2d("utgw", d.utgw, ncol, pver);
+  const auto vtgw_d = to_device_2d("vtgw", d.vtgw, ncol, pver);
+  const auto c_d    = spectrum_to_device("c", d.c, ncol, 1, nwaves, c_idx);
+  const auto tau_d  = spectrum_to_device("tau", d.tau, ncol, pver+1, nwaves, tau_idx);
+  const auto gwut_d = spectrum_to_device("gwut", d.gwut, ncol, pver, nwaves, gwut_idx);
+
+  const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(ncol, c_d.extent(2));
+  Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
+    const Int i = team.league_rank();
+
+    GWFD::gwd_compute_tendencies_from_stress_divergence(
+      team, init, ngwv, do_taper, dt, effgw, tend_level_d(i), lat_d(i),
+      ekat::subview(dpm_d, i), ekat::subview(rdpm_d, i),
+      Kokkos::subview(c_d, i, 0, Kokkos::ALL()),
+      ekat::subview(ubm_d, i), ekat::subview(t_d, i), ekat::subview(nm_d, i),
+      xv_d(i), yv_d(i),
+      Kokkos::subview(tau_d, i, Kokkos::ALL(), Kokkos::ALL()),
+      Kokkos::subview(gwut_d, i, Kokkos::ALL(), Kokkos::ALL()),
+      ekat::subview(utgw_d, i), ekat::subview(vtgw_d, i));
+  });
+
+  spectrum_to_host(tau_d, d.tau, nwaves, tau_idx);
+  spectrum_to_host(gwut_d, d.gwut, nwaves, gwut_idx);
+  to_host_2d(utgw_d, d.utgw);
+  to_host_2d(vtgw_d, d.vtgw);
 }
 
 void gw_prof(GwProfData& d)
@@ -100,18 +240,80 @@ void momentum_energy_conservation(MomentumEnergyConservationData& d)
 
 void gwd_compute_stress_profiles_and_diffusivities(GwdComputeStressProfilesAndDiffusivitiesData& d)
 {
-  gw_init(d.init);
-  d.transpose<ekat::TransposeDirection::c2f>();
-  gwd_compute_stress_profiles_and_diffusivities_c(d.ncol, d.ngwv, d.src_level, d.ubi, d.c, d.rhoi, d.ni, d.kvtt, d.t, d.ti, d.piln, d.tau);
-  d.transpose<ekat::TransposeDirection::f2c>();
+  const auto init = gw_common_init_cxx(d.init);
+  const Int ncol = d.ncol, ngwv = d.ngwv, pver = d.init.pver, pgwv = d.init.pgwv;
+  const Int nwaves = 2*pgwv + 1;
+
+  // Host layouts: c(ncol,nwaves), tau(ncol,nwaves,pver+1)
+  const auto c_idx   = [&](Int i, Int, Int j) { return i*nwaves + j; };
+  const auto tau_idx = [&](Int i, Int k, Int j) { return (i*nwaves + j)*(pver+1) + k; };
+
+  const auto src_level_d = to_device_1d("src_level", d.src_level, ncol);
+  const auto ubi_d  = to_device_2d("ubi", d.ubi, ncol, pver+1);
+  const auto rhoi_d = to_device_2d("rhoi", d.rhoi, ncol, pver+1);
+  const auto ni_d   = to_device_2d("ni", d.ni, ncol, pver+1);
+  const auto kvtt_d = to_device_2d("kvtt", d.kvtt, ncol, pver+1);
+  const auto ti_d   = to_device_2d("ti", d.ti, ncol, pver+1);
+  const auto piln_d = to_device_2d("piln", d.piln, ncol, pver+1);
+  const auto t_d    = to_device_2d("t", d.t, ncol, pver);
+  const auto c_d    = spectrum_to_device("c", d.c, ncol, 1, nwaves, c_idx);
+  const auto tau_d  = spectrum_to_device("tau", d.tau, ncol, pver+1, nwaves, tau_idx);
+
+  const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(ncol, c_d.extent(2));
+  Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
+    const Int i = team.league_rank();
+
+    GWFD::gwd_compute_stress_profiles_and_diffusivities(
+      team, init, ngwv, src_level_d(i),
+      ekat::subview(ubi_d, i),
+      Kokkos::subview(c_d, i, 0, Kokkos::ALL()),
+      ekat::subview(rhoi_d, i), ekat::subview(ni_d, i), ekat::subview(kvtt_d, i),
+      ekat::subview(t_d, i), ekat::subview(ti_d, i), ekat::subview(piln_d, i),
+      Kokkos::subview(tau_d, i, Kokkos::ALL(), Kokkos::ALL()));
+  });
+
+  spectrum_to_host(tau_d, d.tau, nwaves, tau_idx);
 }
 
 void gwd_project_tau(GwdProjectTauData& d)
 {
-  gw_init(d.init);
-  d.transpose<ekat::TransposeDirection::c2f>();
-  gwd_project_tau_c(d.ncol, d.ngwv, d.tend_level, d.tau, d.ubi, d.c, d.xv, d.yv, d.taucd);
-  d.transpose<ekat::TransposeDirection::f2c>();
+  const auto init = gw_common_init_cxx(d.init);
+  const Int ncol = d.ncol, ngwv = d.ngwv, pver = d.init.pver, pgwv = d.init.pgwv;
+  const Int nwaves = 2*pgwv + 1;
+
+  // Host layouts: c(ncol,nwaves), tau(ncol,nwaves,pver+1), taucd(ncol,pver+1,4)
+  const auto c_idx   = [&](Int i, Int, Int j) { return i*nwaves + j; };
+  const auto tau_idx = [&](Int i, Int k, Int j) { return (i*nwaves + j)*(pver+1) + k; };
+
+  const auto tend_level_d = to_device_1d("tend_level", d.tend_level, ncol);
+  const auto xv_d    = to_device_1d("xv", d.xv, ncol);
+  const auto yv_d    = to_device_1d("yv", d.yv, ncol);
+  const auto ubi_d   = to_device_2d("ubi", d.ubi, ncol, pver+1);
+  const auto c_d     = spectrum_to_device("c", d.c, ncol, 1, nwaves, c_idx);
+  const auto tau_d   = spectrum_to_device("tau", d.tau, ncol, pver+1, nwaves, tau_idx);
+
+  dview_3d<Real> taucd_d("taucd", ncol, pver+1, 4);
+  {
+    auto taucd_h = Kokkos::create_mirror_view(taucd_d);
+    std::copy(d.taucd, d.taucd + taucd_h.size(), taucd_h.data());
+    Kokkos::deep_copy(taucd_d, taucd_h);
+  }
+
+  const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(ncol, pver+1);
+  Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
+    const Int i = team.league_rank();
+
+    GWFD::gwd_project_tau(
+      team, init, ngwv, tend_level_d(i),
+      Kokkos::subview(tau_d, i, Kokkos::ALL(), Kokkos::ALL()),
+      ekat::subview(ubi_d, i),
+      Kokkos::subview(c_d, i, 0, Kokkos::ALL()),
+      xv_d(i), yv_d(i),
+      Kokkos::subview(taucd_d, i, Kokkos::ALL(), Kokkos::ALL()));
+  });
+
+  auto taucd_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), taucd_d);
+  std::copy(taucd_h.data(), taucd_h.data() + taucd_h.size(), d.taucd);
 }
 
 void gwd_precalc_rhoi(GwdPrecalcRhoiData& d)
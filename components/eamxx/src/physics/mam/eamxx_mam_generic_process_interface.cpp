@@ -11,6 +11,7 @@ MAMGenericInterface::MAMGenericInterface(const ekat::Comm &comm,
                                          const ekat::ParameterList &params)
     : AtmosphereProcess(comm, params) {
       use_prescribed_ozone_   = m_params.get<bool>("use_mam4_precribed_ozone", false);
+      share_dry_aero_         = m_params.get<bool>("share_dry_aerosol_state", false);
   /* Anything that can be initialized without grid information can be
    * initialized here. Like universal constants, mam wetscav options.
    */
@@ -225,14 +226,24 @@ void MAMGenericInterface::populate_cloudborne_dry_aero(
   // number (n) mixing ratios
   for(int m = 0; m < mam_coupling::num_aero_modes(); ++m) {
     // cloudborne aerosol tracers of interest: number (n) mixing ratios
-    dry_aero.cld_aero_nmr[m] = buffer.dry_cld_aero_nmr[m];
+    dry_aero.cld_aero_nmr[m] =
+        share_dry_aero_
+            ? get_shared_dry_view(
+                  shared_dry_aero_state().dry_aero.cld_aero_nmr[m],
+                  mam_coupling::cld_aero_nmr_field_name(m))
+            : buffer.dry_cld_aero_nmr[m];
 
     for(int a = 0; a < mam_coupling::num_aero_species(); ++a) {
       // (cloudborne) aerosol tracers of interest: mass (q) mixing ratios
       const std::string cld_mmr_field_name =
           mam_coupling::cld_aero_mmr_field_name(m, a);
       if(not cld_mmr_field_name.empty()) {
-        dry_aero.cld_aero_mmr[m][a] = buffer.dry_cld_aero_mmr[m][a];
+        dry_aero.cld_aero_mmr[m][a] =
+            share_dry_aero_
+                ? get_shared_dry_view(
+                      shared_dry_aero_state().dry_aero.cld_aero_mmr[m][a],
+                      cld_mmr_field_name)
+                : buffer.dry_cld_aero_mmr[m][a];
       }
     }
   }
@@ -258,7 +269,11 @@ void MAMGenericInterface::set_field_w_scratch_buffer(
 void MAMGenericInterface::populate_gases_dry_aero(
     mam_coupling::AerosolState &dry_aero, mam_coupling::Buffer &buffer) {
   for(int g = 0; g < mam_coupling::num_aero_gases(); ++g) {
-    dry_aero.gas_mmr[g] = buffer.dry_gas_mmr[g];
+    dry_aero.gas_mmr[g] =
+        share_dry_aero_
+            ? get_shared_dry_view(shared_dry_aero_state().dry_aero.gas_mmr[g],
+                                  mam_coupling::gas_mmr_name[g])
+            : buffer.dry_gas_mmr[g];
   }
 }
 // ================================================================
@@ -283,7 +298,12 @@ void MAMGenericInterface::populate_interstitial_dry_aero(
   // number (n) mixing ratios
   for(int m = 0; m < mam_coupling::num_aero_modes(); ++m) {
     // interstitial aerosol tracers of interest: number (n) mixing ratios
-    dry_aero.int_aero_nmr[m] = buffer.dry_int_aero_nmr[m];
+    dry_aero.int_aero_nmr[m] =
+        share_dry_aero_
+            ? get_shared_dry_view(
+                  shared_dry_aero_state().dry_aero.int_aero_nmr[m],
+                  mam_coupling::int_aero_nmr_field_name(m))
+            : buffer.dry_int_aero_nmr[m];
 
     for(int a = 0; a < mam_coupling::num_aero_species(); ++a) {
       // (interstitial) aerosol tracers of interest: mass (q) mixing ratios
@@ -291,7 +311,12 @@ void MAMGenericInterface::populate_interstitial_dry_aero(
           mam_coupling::int_aero_mmr_field_name(m, a);
 
       if(not int_mmr_field_name.empty()) {
-        dry_aero.int_aero_mmr[m][a] = buffer.dry_int_aero_mmr[m][a];
+        dry_aero.int_aero_mmr[m][a] =
+            share_dry_aero_
+                ? get_shared_dry_view(
+                      shared_dry_aero_state().dry_aero.int_aero_mmr[m][a],
+                      int_mmr_field_name)
+                : buffer.dry_int_aero_mmr[m][a];
       }
     }
   }
@@ -457,10 +482,55 @@ void MAMGenericInterface::add_interval_checks() {
   }
 }
 
+// ================================================================
+auto MAMGenericInterface::shared_dry_aero_state() -> SharedDryAerosolState & {
+  static SharedDryAerosolState state;
+  return state;
+}
+// ================================================================
+mam_coupling::view_2d MAMGenericInterface::get_shared_dry_view(
+    mam_coupling::view_2d &v, const std::string &name) const {
+  if(v.data() == nullptr) {
+    v = mam_coupling::view_2d("shared_dry_" + name, ncol_, nlev_);
+  }
+  EKAT_REQUIRE_MSG(v.extent_int(0) == ncol_ && v.extent_int(1) == nlev_,
+                   "Error! Shared dry aerosol state has wrong extents.\n"
+                   "  - field name: " + name + "\n"
+                   "  - process   : " + this->name() + "\n");
+  return v;
+}
+// ================================================================
+util::TimeStamp MAMGenericInterface::wet_aero_time_stamp() {
+  // All wet aerosol fields are updated together by the MAM processes
+  return get_field_out(mam_coupling::int_aero_nmr_field_name(0))
+      .get_header()
+      .get_tracking()
+      .get_time_stamp();
+}
+// ================================================================
+bool MAMGenericInterface::is_shared_dry_aero_current() {
+  if(not share_dry_aero_) return false;
+  const auto &state = shared_dry_aero_state();
+  if(state.writer_run_count < 0) return false;
+  // If the writer is still running (i.e., we are a later subcycle of that same
+  // process), the wet fields have not been re-stamped yet. Otherwise, the
+  // writer must have been the very last process to run.
+  const auto run_count = get_global_run_count();
+  if(run_count == state.writer_run_count) {
+    return wet_aero_time_stamp() == state.writer_ts_in_run;
+  } else if(run_count == state.writer_run_count + 1) {
+    return wet_aero_time_stamp() == state.writer_ts_after_run;
+  }
+  return false;
+}
+// ================================================================
 void MAMGenericInterface::pre_process(mam_coupling::AerosolState &wet_aero,
                                       mam_coupling::AerosolState &dry_aero,
                                       mam_coupling::WetAtmosphere &wet_atm,
                                       mam_coupling::DryAtmosphere &dry_atm) {
+  // The wet->dry conversion of the aerosols can be skipped if the previous
+  // MAM process left the (shared) dry state consistent with the wet fields
+  const bool convert_aero = not is_shared_dry_aero_current();
   const auto scan_policy = ekat::ExeSpaceUtils<
       KT::ExeSpace>::get_thread_range_parallel_scan_team_policy(ncol_, nlev_);
   Kokkos::parallel_for(
@@ -468,8 +538,10 @@ void MAMGenericInterface::pre_process(mam_coupling::AerosolState &wet_aero,
         const int i = team.league_rank();  // column index
 
         mam_coupling::compute_dry_mixing_ratios(team, wet_atm, dry_atm, i);
-        mam_coupling::compute_dry_mixing_ratios(team, wet_atm, wet_aero,
-                                                dry_aero, i);
+        if(convert_aero) {
+          mam_coupling::compute_dry_mixing_ratios(team, wet_atm, wet_aero,
+                                                  dry_aero, i);
+        }
         team.team_barrier();
         // vertical heights has to be computed after computing dry mixing ratios
         // for atmosphere
@@ -490,5 +562,16 @@ void MAMGenericInterface::post_process(mam_coupling::AerosolState &wet_aero,
         const int i = team.league_rank();  // column index
         compute_wet_mixing_ratios(team, dry_atm, dry_aero, wet_aero, i);
       });
+
+  if(share_dry_aero_) {
+    // The wet fields now match the shared dry state. Record when they will
+    // be stamped, so the next MAM process can tell if nobody else touched them.
+    auto &state               = shared_dry_aero_state();
+    state.writer_run_count    = get_global_run_count();
+    state.writer_ts_in_run    = wet_aero_time_stamp();
+    state.writer_ts_after_run = do_update_time_stamp()
+                                    ? end_of_step_ts()
+                                    : state.writer_ts_in_run;
+  }
 }
 }  // namespace scream
@@ -77,6 +77,10 @@ class MAMGenericInterface : public scream::AtmosphereProcess {
 
   //namelist variables (declared protected so that derived classes can access them)
   bool use_prescribed_ozone_{false};  // use prescribed ozone from MAM4
+  // If true, the dry aerosol state lives in storage shared by all MAM
+  // processes, and pre_process skips the wet->dry conversion when the dry
+  // state written by the previous MAM process is still current.
+  bool share_dry_aero_{false};
 
  private:
   // The type of subcomponent
@@ -90,6 +94,24 @@ class MAMGenericInterface : public scream::AtmosphereProcess {
   bool set_ranges_{false};
   int i_scratch_vars_{0};
 
+  // Dry aerosol mixing ratios shared by the MAM processes with share_dry_aero_=true
+  struct SharedDryAerosolState {
+    mam_coupling::AerosolState dry_aero;
+    // Global run count of the last process that converted dry_aero back to
+    // wet mixing ratios (-1 if none), and the time stamps its wet fields have
+    // during its run and after it completes.
+    long long writer_run_count = -1;
+    util::TimeStamp writer_ts_in_run;
+    util::TimeStamp writer_ts_after_run;
+  };
+  static SharedDryAerosolState &shared_dry_aero_state();
+  // Returns the shared view for a dry aerosol quantity, allocating it if needed
+  mam_coupling::view_2d get_shared_dry_view(mam_coupling::view_2d &v,
+                                            const std::string &name) const;
+  // Whether the shared dry state matches the current wet state
+  bool is_shared_dry_aero_current();
+  util::TimeStamp wet_aero_time_stamp();
+
 };  // MAMGenericInterface
 }  // namespace scream
 
@@ -43,6 +43,9 @@ class MAMMicrophysics final : public MAMGenericInterface {
   // The name of the subcomponent
   std::string name() const { return "mam_aero_microphysics"; }
 
+  // The tracer/linoz data readers can only move forward in time
+  bool supports_state_reset() const override { return false; }
+
   // grid
   void set_grids(
       const std::shared_ptr<const GridsManager> grids_manager) override;
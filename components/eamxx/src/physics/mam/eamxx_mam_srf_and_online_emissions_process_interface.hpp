@@ -69,6 +69,9 @@ class MAMSrfOnlineEmiss final : public MAMGenericInterface {
   // The name of the subcomponent
   std::string name() const { return "mam_srf_online_emissions"; }
 
+  // The emission data readers can only move forward in time
+  bool supports_state_reset() const override { return false; }
+
   // grid
   void set_grids(
       const std::shared_ptr<const GridsManager> grids_manager) override;
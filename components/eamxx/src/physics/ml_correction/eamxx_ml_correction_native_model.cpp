@@ -0,0 +1,262 @@
+#include "eamxx_ml_correction_native_model.hpp"
+
+#include <ekat/ekat_assert.hpp>
+#include <ekat/kokkos/ekat_kokkos_utils.hpp>
+
+#include <fstream>
+
+namespace scream {
+
+namespace {
+
+// Columns processed together by one team: each weight is loaded once per block
+constexpr int col_block = 8;
+
+template<typename T>
+void read_token (std::ifstream& ifs, T& val, const std::string& what, const std::string& filename) {
+  ifs >> val;
+  EKAT_REQUIRE_MSG (not ifs.fail(),
+      "Error! Could not read " + what + " from ML correction model file.\n"
+      " - file name: " + filename + "\n");
+}
+
+void read_keyword (std::ifstream& ifs, const std::string& expected, const std::string& filename) {
+  std::string kw;
+  read_token(ifs,kw,"keyword '" + expected + "'",filename);
+  EKAT_REQUIRE_MSG (kw==expected,
+      "Error! Unexpected keyword in ML correction model file.\n"
+      " - file name: " + filename + "\n"
+      " - expected : " + expected + "\n"
+      " - found    : " + kw + "\n");
+}
+
+KOKKOS_INLINE_FUNCTION
+Real activate (const MLCorrectionNativeModel::Activation a, const Real x) {
+  using A = MLCorrectionNativeModel::Activation;
+  switch (a) {
+    case A::ReLU: return x>0 ? x : Real(0);
+    case A::Tanh: return Kokkos::tanh(x);
+    default:      return x;
+  }
+}
+
+} // anonymous namespace
+
+MLCorrectionNativeModel::
+MLCorrectionNativeModel (const std::string& filename)
+{
+  read(filename);
+}
+
+void MLCorrectionNativeModel::
+read (const std::string& filename)
+{
+  std::ifstream ifs(filename);
+  EKAT_REQUIRE_MSG (ifs.good(),
+      "Error! Could not open ML correction model file.\n"
+      " - file name: " + filename + "\n");
+
+  int version;
+  read_keyword(ifs,"eamxx_ml_native_model",filename);
+  read_token(ifs,version,"format version",filename);
+  EKAT_REQUIRE_MSG (version==1,
+      "Error! Unsupported ML correction model file version.\n"
+      " - file name: " + filename + "\n"
+      " - version  : " + std::to_string(version) + "\n");
+
+  auto read_vars = [&](std::vector<Variable>& vars, const std::string& kw) {
+    int n;
+    read_keyword(ifs,kw,filename);
+    read_token(ifs,n,"number of " + kw,filename);
+    int offset = 0;
+    for (int i=0; i<n; ++i) {
+      Variable v;
+      read_token(ifs,v.name,kw + " name",filename);
+      read_token(ifs,v.size,kw + " size",filename);
+      v.offset = offset;
+      offset += v.size;
+      vars.push_back(v);
+    }
+    return offset;
+  };
+  auto read_scaling = [&](view_1d<Real>& mean, view_1d<Real>& stdev, const int n, const std::string& kw) {
+    read_keyword(ifs,kw,filename);
+    mean  = view_1d<Real>(kw + "_mean",n);
+    stdev = view_1d<Real>(kw + "_std",n);
+    auto mean_h = Kokkos::create_mirror_view(mean);
+    auto std_h  = Kokkos::create_mirror_view(stdev);
+    for (int i=0; i<n; ++i) {
+      read_token(ifs,mean_h(i),kw + " mean",filename);
+      read_token(ifs,std_h(i),kw + " std",filename);
+    }
+    Kokkos::deep_copy(mean,mean_h);
+    Kokkos::deep_copy(stdev,std_h);
+  };
+
+  m_num_in = read_vars(m_inputs,"inputs");
+  read_scaling(m_in_mean,m_in_std,m_num_in,"input_normalization");
+
+  int nlayers;
+  read_keyword(ifs,"layers",filename);
+  read_token(ifs,nlayers,"number of layers",filename);
+  EKAT_REQUIRE_MSG (nlayers>0,
+      "Error! ML correction model must have at least one layer.\n"
+      " - file name: " + filename + "\n");
+  int n_prev = m_num_in;
+  for (int l=0; l<nlayers; ++l) {
+    Layer layer;
+    std::string act;
+    read_token(ifs,layer.n_in,"layer input size",filename);
+    read_token(ifs,layer.n_out,"layer output size",filename);
+    read_token(ifs,act,"layer activation",filename);
+    EKAT_REQUIRE_MSG (layer.n_in==n_prev,
+        "Error! Inconsistent layer sizes in ML correction model file.\n"
+        " - file name: " + filename + "\n"
+        " - layer    : " + std::to_string(l) + "\n");
+    if (act=="relu") {
+      layer.activation = Activation::ReLU;
+    } else if (act=="tanh") {
+      layer.activation = Activation::Tanh;
+    } else if (act=="linear") {
+      layer.activation = Activation::Linear;
+    } else {
+      EKAT_ERROR_MSG ("Error! Unsupported activation in ML correction model file.\n"
+          " - file name : " + filename + "\n"
+          " - activation: " + act + "\n"
+          " - supported : relu, tanh, linear\n");
+    }
+
+    layer.weights = view_2d<Real>("weights",layer.n_out,layer.n_in);
+    layer.bias    = view_1d<Real>("bias",layer.n_out);
+    auto w_h = Kokkos::create_mirror_view(layer.weights);
+    auto b_h = Kokkos::create_mirror_view(layer.bias);
+    for (int o=0; o<layer.n_out; ++o) {
+      for (int i=0; i<layer.n_in; ++i) {
+        read_token(ifs,w_h(o,i),"layer weights",filename);
+      }
+    }
+    for (int o=0; o<layer.n_out; ++o) {
+      read_token(ifs,b_h(o),"layer bias",filename);
+    }
+    Kokkos::deep_copy(layer.weights,w_h);
+    Kokkos::deep_copy(layer.bias,b_h);
+
+    m_max_width = std::max(m_max_width,layer.n_out);
+    n_prev = layer.n_out;
+    m_layers.push_back(layer);
+  }
+
+  m_num_out = read_vars(m_outputs,"outputs");
+  EKAT_REQUIRE_MSG (m_num_out==n_prev,
+      "Error! Model outputs do not match the size of the last layer.\n"
+      " - file name  : " + filename + "\n"
+      " - outputs    : " + std::to_string(m_num_out) + "\n"
+      " - last layer : " + std::to_string(n_prev) + "\n");
+  read_scaling(m_out_mean,m_out_std,m_num_out,"output_denormalization");
+
+  m_max_width = std::max(m_max_width,m_num_in);
+}
+
+auto MLCorrectionNativeModel::
+find_input (const std::string& name) const -> const Variable*
+{
+  for (const auto& v : m_inputs) {
+    if (v.name==name) return &v;
+  }
+  return nullptr;
+}
+
+auto MLCorrectionNativeModel::
+find_output (const std::string& name) const -> const Variable*
+{
+  for (const auto& v : m_outputs) {
+    if (v.name==name) return &v;
+  }
+  return nullptr;
+}
+
+void MLCorrectionNativeModel::
+predict (const view_2d<const Real>& x, const view_2d<Real>& y) const
+{
+  using RangePolicy = Kokkos::RangePolicy<KT::ExeSpace>;
+  using TeamPolicy  = typename KT::TeamPolicy;
+  using MemberType  = typename KT::MemberType;
+
+  const int ncol = x.extent(0);
+  EKAT_REQUIRE_MSG (static_cast<int>(x.extent(1))==m_num_in,
+      "Error! Wrong number of input features for ML correction model.\n");
+  EKAT_REQUIRE_MSG (static_cast<int>(y.extent(0))>=ncol and static_cast<int>(y.extent(1))==m_num_out,
+      "Error! Wrong output view extents for ML correction model.\n");
+
+  for (auto& w : m_work) {
+    if (static_cast<int>(w.extent(0))<ncol or static_cast<int>(w.extent(1))<m_max_width) {
+      w = view_2d<Real>("ml_correction_work",ncol,m_max_width);
+    }
+  }
+
+  // Normalize the inputs
+  const int nin = m_num_in;
+  auto in_mean = m_in_mean;
+  auto in_std  = m_in_std;
+  auto x0 = m_work[0];
+  Kokkos::parallel_for("MLCorrectionNativeModel::normalize",
+                       RangePolicy(0,ncol*nin),
+                       KOKKOS_LAMBDA(const int idx) {
+    const int icol = idx / nin;
+    const int i    = idx % nin;
+    x0(icol,i) = (x(icol,i) - in_mean(i)) / in_std(i);
+  });
+
+  // Dense layers. Each team handles a block of columns, so that each row of
+  // the weights matrix is read once per block rather than once per column.
+  const int nblocks = (ncol + col_block - 1) / col_block;
+  const int nlayers = m_layers.size();
+  for (int l=0; l<nlayers; ++l) {
+    const auto& layer = m_layers[l];
+    const auto W   = layer.weights;
+    const auto b   = layer.bias;
+    const auto act = layer.activation;
+    const int n_in  = layer.n_in;
+    const int n_out = layer.n_out;
+    const auto xin  = m_work[l % 2];
+    const auto xout = m_work[(l+1) % 2];
+
+    const TeamPolicy policy(nblocks,Kokkos::AUTO);
+    Kokkos::parallel_for("MLCorrectionNativeModel::dense",policy,
+                         KOKKOS_LAMBDA(const MemberType& team) {
+      const int c0 = team.league_rank()*col_block;
+      const int nc = ncol-c0<col_block ? ncol-c0 : col_block;
+      Kokkos::parallel_for(Kokkos::TeamThreadRange(team,n_out),
+                           [&](const int o) {
+        Real acc[col_block];
+        for (int c=0; c<nc; ++c) {
+          acc[c] = b(o);
+        }
+        for (int i=0; i<n_in; ++i) {
+          const Real w = W(o,i);
+          for (int c=0; c<nc; ++c) {
+            acc[c] += w*xin(c0+c,i);
+          }
+        }
+        for (int c=0; c<nc; ++c) {
+          xout(c0+c,o) = activate(act,acc[c]);
+        }
+      });
+    });
+  }
+
+  // Denormalize the outputs
+  const int nout = m_num_out;
+  auto out_mean = m_out_mean;
+  auto out_std  = m_out_std;
+  auto xl = m_work[nlayers % 2];
+  Kokkos::parallel_for("MLCorrectionNativeModel::denormalize",
+                       RangePolicy(0,ncol*nout),
+                       KOKKOS_LAMBDA(const int idx) {
+    const int icol = idx / nout;
+    const int o    = idx % nout;
+    y(icol,o) = xl(icol,o)*out_std(o) + out_mean(o);
+  });
+}
+
+} // namespace scream
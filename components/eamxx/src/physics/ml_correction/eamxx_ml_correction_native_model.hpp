@@ -0,0 +1,100 @@
+#ifndef SCREAM_ML_CORRECTION_NATIVE_MODEL_HPP
+#define SCREAM_ML_CORRECTION_NATIVE_MODEL_HPP
+
+#include "share/eamxx_types.hpp"
+
+#include <ekat/kokkos/ekat_kokkos_types.hpp>
+
+#include <string>
+#include <vector>
+
+namespace scream {
+
+/*
+ * A dense feed-forward network evaluated in-process, on device, over all columns.
+ *
+ * This is the native counterpart of the python models used by MLCorrection.
+ * The network weights are read once at init from a plain-text file:
+ *
+ *   eamxx_ml_native_model 1
+ *   inputs <n>
+ *   <name> <size>                         (n lines; size is nlev or 1)
+ *   input_normalization
+ *   <mean> <std>                          (one line per input feature)
+ *   layers <nlayers>
+ *   <n_in> <n_out> <activation>           (relu, tanh or linear), followed by
+ *   <n_out*n_in weights (row major)> <n_out biases>
+ *   outputs <m>
+ *   <name> <size>                         (m lines)
+ *   output_denormalization
+ *   <mean> <std>                          (one line per output feature)
+ *
+ * The features of each column are the concatenation of the inputs, in the
+ * order listed in the file. Inputs are normalized as (x-mean)/std before
+ * the first layer, and outputs are mapped back as y*std+mean.
+ */
+
+class MLCorrectionNativeModel
+{
+public:
+  using KT = ekat::KokkosTypes<DefaultDevice>;
+
+  template<typename T>
+  using view_1d = typename KT::template view_1d<T>;
+  template<typename T>
+  using view_2d = typename KT::template view_2d<T>;
+
+  enum class Activation { Linear, ReLU, Tanh };
+
+  struct Variable {
+    std::string name;
+    int size;     // Number of features (nlev for 3d fields, 1 for 2d fields)
+    int offset;   // Position of the first feature in the input/output vector
+  };
+
+  MLCorrectionNativeModel (const std::string& filename);
+
+  const std::vector<Variable>& inputs  () const { return m_inputs;  }
+  const std::vector<Variable>& outputs () const { return m_outputs; }
+
+  int num_input_features  () const { return m_num_in;  }
+  int num_output_features () const { return m_num_out; }
+
+  // Returns the variable with the given name, or nullptr if the model does not use it
+  const Variable* find_input  (const std::string& name) const;
+  const Variable* find_output (const std::string& name) const;
+
+  // Evaluates the network for the first ncol columns of x (raw, un-normalized
+  // features, shape (ncol,num_input_features)), storing the denormalized
+  // outputs in y (shape (ncol,num_output_features)).
+  void predict (const view_2d<const Real>& x, const view_2d<Real>& y) const;
+
+protected:
+  struct Layer {
+    int n_in;
+    int n_out;
+    Activation activation;
+    view_2d<Real> weights;   // (n_out,n_in)
+    view_1d<Real> bias;      // (n_out)
+  };
+
+  void read (const std::string& filename);
+
+  std::vector<Variable> m_inputs;
+  std::vector<Variable> m_outputs;
+  std::vector<Layer>    m_layers;
+
+  int m_num_in  = 0;
+  int m_num_out = 0;
+  int m_max_width = 0;
+
+  view_1d<Real> m_in_mean, m_in_std;
+  view_1d<Real> m_out_mean, m_out_std;
+
+  // Ping-pong buffers for the hidden layers, resized on demand
+  mutable view_2d<Real> m_work[2];
+};
+
+} // namespace scream
+
+#endif // SCREAM_ML_CORRECTION_NATIVE_MODEL_HPP
@@ -5,6 +5,9 @@
 #include "physics/share/physics_constants.hpp"
 #include "share/property_checks/field_lower_bound_check.hpp"
 #include "share/property_checks/field_within_interval_check.hpp"
+#include "physics/rrtmgp/shr_orb_mod_c2f.hpp"
+
+#include <ekat/util/ekat_string_utils.hpp>
 
 namespace scream {
 // =========================================================================================
@@ -16,6 +19,11 @@ MLCorrection::MLCorrection(const ekat::Comm &comm,
   m_ML_model_path_sfc_fluxes = m_params.get<std::string>("ml_model_path_sfc_fluxes");
   m_fields_ml_output_variables = m_params.get<std::vector<std::string>>("ml_output_fields");
   m_ML_correction_unit_test = m_params.get<bool>("ml_correction_unit_test");
+  m_backend = m_params.get<std::string>("ml_correction_backend","python");
+  EKAT_REQUIRE_MSG (m_backend=="python" or m_backend=="native",
+      "Error! Invalid value for 'ml_correction_backend'.\n"
+      " - value: " + m_backend + "\n"
+      " - valid values: python, native\n");
 }
 
 // =========================================================================================
@@ -72,18 +80,42 @@ void MLCorrection::set_grids(
 
 // =========================================================================================
 void MLCorrection::initialize_impl(const RunType /* run_type */) {
-  fpe_mask = ekat::get_enabled_fpes();
-  ekat::disable_all_fpes();  // required for importing numpy
-  if ( Py_IsInitialized() == 0 ) {
-    pybind11::initialize_interpreter();
+  if (m_backend=="native") {
+    // The native models are read once, and evaluated on device at every step
+    auto load = [](const std::string& path) -> std::shared_ptr<MLCorrectionNativeModel> {
+      if (ekat::upper_case(path)=="NONE") {
+        return nullptr;
+      }
+      return std::make_shared<MLCorrectionNativeModel>(path);
+    };
+    m_native_model_tq         = load(m_ML_model_path_tq);
+    m_native_model_uv         = load(m_ML_model_path_uv);
+    m_native_model_sfc_fluxes = load(m_ML_model_path_sfc_fluxes);
+
+    int max_in = 0, max_out = 0;
+    for (auto model : {m_native_model_tq, m_native_model_uv, m_native_model_sfc_fluxes}) {
+      if (model) {
+        max_in  = std::max(max_in,model->num_input_features());
+        max_out = std::max(max_out,model->num_output_features());
+      }
+    }
+    m_native_inputs  = decltype(m_native_inputs)("ml_correction_inputs",m_num_cols*max_in);
+    m_native_outputs = decltype(m_native_outputs)("ml_correction_outputs",m_num_cols*max_out);
+    m_cos_zenith     = decltype(m_cos_zenith)("ml_correction_cos_zenith",m_num_cols);
+  } else {
+    fpe_mask = ekat::get_enabled_fpes();
+    ekat::disable_all_fpes();  // required for importing numpy
+    if ( Py_IsInitialized() == 0 ) {
+      pybind11::initialize_interpreter();
+    }
+    pybind11::module sys = pybind11::module::import("sys");
+    sys.attr("path").attr("insert")(1, ML_CORRECTION_CUSTOM_PATH);
+    py_correction = pybind11::module::import("ml_correction");
+    ML_model_tq = py_correction.attr("get_ML_model")(m_ML_model_path_tq);
+    ML_model_uv = py_correction.attr("get_ML_model")(m_ML_model_path_uv);
+    ML_model_sfc_fluxes = py_correction.attr("get_ML_model")(m_ML_model_path_sfc_fluxes);
+    ekat::enable_fpes(fpe_mask);
   }
-  pybind11::module sys = pybind11::module::import("sys");
-  sys.attr("path").attr("insert")(1, ML_CORRECTION_CUSTOM_PATH);
-  py_correction = pybind11::module::import("ml_correction");
-  ML_model_tq = py_correction.attr("get_ML_model")(m_ML_model_path_tq);
-  ML_model_uv = py_correction.attr("get_ML_model")(m_ML_model_path_uv);
-  ML_model_sfc_fluxes = py_correction.attr("get_ML_model")(m_ML_model_path_sfc_fluxes);
-  ekat::enable_fpes(fpe_mask);
 
   // Enforce bounds on quantities adjusted by ML using Field Property Checks
   using LowerBound = FieldLowerBoundCheck;
@@ -98,66 +130,17 @@ void MLCorrection::initialize_impl(const RunType /* run_type */) {
 
 // =========================================================================================
 void MLCorrection::run_impl(const double dt) {
-  // use model time to infer solar zenith angle for the ML prediction
-  auto current_ts = start_of_step_ts();
-  std::string datetime_str = current_ts.get_date_string() + " " + current_ts.get_time_string();
-
-  const auto &phis            = get_field_in("phis").get_view<const Real *, Host>();
-  const auto &sfc_alb_dif_vis = get_field_in("sfc_alb_dif_vis").get_view<const Real *, Host>();
-
-  const auto &qv              = get_field_out("qv").get_view<Real **, Host>();
-  const auto &T_mid           = get_field_out("T_mid").get_view<Real **, Host>();
-  const auto &SW_flux_dn      = get_field_out("SW_flux_dn").get_view<Real **, Host>();
-  const auto &sfc_flux_sw_net = get_field_out("sfc_flux_sw_net").get_view<Real *, Host>();
-  const auto &sfc_flux_lw_dn  = get_field_out("sfc_flux_lw_dn").get_view<Real *, Host>();
-  const auto &u               = get_field_out("horiz_winds").get_component(0).get_view<Real **, Host>();
-  const auto &v               = get_field_out("horiz_winds").get_component(1).get_view<Real **, Host>();
-
   // For precipitation adjustment we need to track the change in column integrated 'qv'
   // So we clone the original qv before ML changes the state so we can back out a qv_tend
   // to use with precip adjustment.
   auto qv_src = get_field_in("qv");
   auto qv_in = qv_src.clone();
 
-  auto h_lat  = m_lat.get_view<const Real*,Host>();
-  auto h_lon  = m_lon.get_view<const Real*,Host>();
-
-  const auto& tracers = get_group_out("tracers");
-  const auto& tracers_info = tracers.m_info;
-  Int num_tracers = tracers_info->size();
-
-  ekat::disable_all_fpes();  // required for importing numpy
-  if ( Py_IsInitialized() == 0 ) {
-    pybind11::initialize_interpreter();
+  if (m_backend=="native") {
+    run_native(dt);
+  } else {
+    run_python(dt);
   }
-  // for qv, we need to stride across number of tracers
-  pybind11::object ob1     = py_correction.attr("update_fields")(
-      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
-          m_num_cols * m_num_levs, T_mid.data(), pybind11::str{}),
-      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
-          m_num_cols * m_num_levs * num_tracers, qv.data(), pybind11::str{}),
-      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
-          m_num_cols * m_num_levs, u.data(), pybind11::str{}),
-      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
-          m_num_cols * m_num_levs, v.data(), pybind11::str{}),
-      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
-          m_num_cols, h_lat.data(), pybind11::str{}),
-      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
-          m_num_cols, h_lon.data(), pybind11::str{}),
-      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
-          m_num_cols, phis.data(), pybind11::str{}),
-      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
-          m_num_cols * (m_num_levs+1), SW_flux_dn.data(), pybind11::str{}),
-      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
-          m_num_cols, sfc_alb_dif_vis.data(), pybind11::str{}),
-      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
-          m_num_cols, sfc_flux_sw_net.data(), pybind11::str{}),
-      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
-          m_num_cols, sfc_flux_lw_dn.data(), pybind11::str{}),
-      m_num_cols, m_num_levs, num_tracers, dt,
-      ML_model_tq, ML_model_uv, ML_model_sfc_fluxes, datetime_str);
-  pybind11::gil_scoped_release no_gil;
-  ekat::enable_fpes(fpe_mask);
 
   // Now back out the qv change abd apply it to precipitation, only if Tq ML is turned on
   if (m_ML_model_path_tq != "none") {
@@ -166,6 +149,7 @@ void MLCorrection::run_impl(const double dt) {
     using MT  = typename KT::MemberType;
     using ESU = ekat::ExeSpaceUtils<typename KT::ExeSpace>;
     const auto &pseudo_density       = get_field_in("pseudo_density").get_view<const Real**>();
+    const auto &T_mid                = get_field_in("T_mid").get_view<const Real**>();
     const auto &precip_liq_surf_mass = get_field_out("precip_liq_surf_mass").get_view<Real *>();
     const auto &precip_ice_surf_mass = get_field_out("precip_ice_surf_mass").get_view<Real *>();
     constexpr Real g = PC::gravit;
@@ -227,6 +211,227 @@ void MLCorrection::run_impl(const double dt) {
   }
 }
 
+// =========================================================================================
+void MLCorrection::run_python(const double dt) {
+  // use model time to infer solar zenith angle for the ML prediction
+  auto current_ts = start_of_step_ts();
+  std::string datetime_str = current_ts.get_date_string() + " " + current_ts.get_time_string();
+
+  const auto &phis            = get_field_in("phis").get_view<const Real *, Host>();
+  const auto &sfc_alb_dif_vis = get_field_in("sfc_alb_dif_vis").get_view<const Real *, Host>();
+
+  const auto &qv              = get_field_out("qv").get_view<Real **, Host>();
+  const auto &T_mid           = get_field_out("T_mid").get_view<Real **, Host>();
+  const auto &SW_flux_dn      = get_field_out("SW_flux_dn").get_view<Real **, Host>();
+  const auto &sfc_flux_sw_net = get_field_out("sfc_flux_sw_net").get_view<Real *, Host>();
+  const auto &sfc_flux_lw_dn  = get_field_out("sfc_flux_lw_dn").get_view<Real *, Host>();
+  const auto &u               = get_field_out("horiz_winds").get_component(0).get_view<Real **, Host>();
+  const auto &v               = get_field_out("horiz_winds").get_component(1).get_view<Real **, Host>();
+
+  auto h_lat  = m_lat.get_view<const Real*,Host>();
+  auto h_lon  = m_lon.get_view<const Real*,Host>();
+
+  const auto& tracers = get_group_out("tracers");
+  const auto& tracers_info = tracers.m_info;
+  Int num_tracers = tracers_info->size();
+
+  ekat::disable_all_fpes();  // required for importing numpy
+  if ( Py_IsInitialized() == 0 ) {
+    pybind11::initialize_interpreter();
+  }
+  // for qv, we need to stride across number of tracers
+  pybind11::object ob1     = py_correction.attr("update_fields")(
+      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
+          m_num_cols * m_num_levs, T_mid.data(), pybind11::str{}),
+      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
+          m_num_cols * m_num_levs * num_tracers, qv.data(), pybind11::str{}),
+      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
+          m_num_cols * m_num_levs, u.data(), pybind11::str{}),
+      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
+          m_num_cols * m_num_levs, v.data(), pybind11::str{}),
+      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
+          m_num_cols, h_lat.data(), pybind11::str{}),
+      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
+          m_num_cols, h_lon.data(), pybind11::str{}),
+      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
+          m_num_cols, phis.data(), pybind11::str{}),
+      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
+          m_num_cols * (m_num_levs+1), SW_flux_dn.data(), pybind11::str{}),
+      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
+          m_num_cols, sfc_alb_dif_vis.data(), pybind11::str{}),
+      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
+          m_num_cols, sfc_flux_sw_net.data(), pybind11::str{}),
+      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
+          m_num_cols, sfc_flux_lw_dn.data(), pybind11::str{}),
+      m_num_cols, m_num_levs, num_tracers, dt,
+      ML_model_tq, ML_model_uv, ML_model_sfc_fluxes, datetime_str);
+  pybind11::gil_scoped_release no_gil;
+  ekat::enable_fpes(fpe_mask);
+}
+
+// =========================================================================================
+void MLCorrection::run_native(const double dt) {
+  // Cosine of the solar zenith angle at the start of the step. The orbital
+  // routines are in Fortran, so this is done on host, as in rrtmgp.
+  auto uses_cosz = [](const std::shared_ptr<MLCorrectionNativeModel>& model) {
+    return model and model->find_input("cos_zenith_angle")!=nullptr;
+  };
+  if (uses_cosz(m_native_model_tq) or uses_cosz(m_native_model_uv) or uses_cosz(m_native_model_sfc_fluxes)) {
+    using PC = scream::physics::Constants<Real>;
+    const auto ts = start_of_step_ts();
+    int orbital_year = ts.get_year();
+    double eccen = -9999, obliq = -9999, mvelp = -9999;
+    double obliqr, lambm0, mvelpp;
+    shr_orb_params_c2f(&orbital_year, &eccen, &obliq, &mvelp,
+                       &obliqr, &lambm0, &mvelpp);
+    double delta, eccf;
+    auto calday = ts.frac_of_year_in_days() + 1;  // Want day + fraction; calday 1 == Jan 1 0Z
+    shr_orb_decl_c2f(calday, eccen, mvelpp, lambm0,
+                     obliqr, &delta, &eccf);
+
+    auto h_lat  = m_lat.get_view<const Real*,Host>();
+    auto h_lon  = m_lon.get_view<const Real*,Host>();
+    auto h_cosz = Kokkos::create_mirror_view(m_cos_zenith);
+    for (int i=0; i<m_num_cols; ++i) {
+      double lat = h_lat(i)*PC::Pi/180.0;  // Convert lat/lon to radians
+      double lon = h_lon(i)*PC::Pi/180.0;
+      // Instantaneous value (no averaging window), as in the python models
+      h_cosz(i) = shr_orb_cosz_c2f(calday, lat, lon, delta, 0.0);
+    }
+    Kokkos::deep_copy(m_cos_zenith,h_cosz);
+  }
+
+  // Same order as the python backend: the wind (and flux) models see the
+  // state already corrected by the T/q model.
+  for (auto model : {m_native_model_tq, m_native_model_uv, m_native_model_sfc_fluxes}) {
+    if (model) {
+      apply_native_model(*model,dt);
+    }
+  }
+}
+
+// =========================================================================================
+void MLCorrection::apply_native_model(const MLCorrectionNativeModel& model, const double dt) {
+  using RangePolicy = Kokkos::RangePolicy<DefaultDevice::execution_space>;
+  using KT = KokkosTypes<DefaultDevice>;
+
+  using view_2d = MLCorrectionNativeModel::view_2d<Real>;
+
+  // The feature buffers are shared by all models, and sized for the widest one
+  const int ncol = m_num_cols;
+  const int nlev = m_num_levs;
+  const view_2d x(m_native_inputs.data(),ncol,model.num_input_features());
+  const view_2d y(m_native_outputs.data(),ncol,model.num_output_features());
+
+  // Gather the input features of all columns. Use strided views, so that
+  // wind components and column slices can be handled like any other field.
+  for (const auto& var : model.inputs()) {
+    const int off = var.offset;
+    KT::sview<const Real**> src_3d;
+    KT::sview<const Real*>  src_2d;
+    bool is_3d = true;
+    if (var.name=="T_mid") {
+      src_3d = get_field_in("T_mid").get_strided_view<const Real**>();
+    } else if (var.name=="qv") {
+      src_3d = get_field_in("qv").get_strided_view<const Real**>();
+    } else if (var.name=="U") {
+      src_3d = get_field_in("horiz_winds").get_component(0).get_strided_view<const Real**>();
+    } else if (var.name=="V") {
+      src_3d = get_field_in("horiz_winds").get_component(1).get_strided_view<const Real**>();
+    } else {
+      is_3d = false;
+      if (var.name=="lat") {
+        src_2d = m_lat.get_strided_view<const Real*>();
+      } else if (var.name=="surface_geopotential") {
+        src_2d = get_field_in("phis").get_strided_view<const Real*>();
+      } else if (var.name=="cos_zenith_angle") {
+        src_2d = m_cos_zenith;
+      } else if (var.name=="surface_diffused_shortwave_albedo") {
+        src_2d = get_field_in("sfc_alb_dif_vis").get_strided_view<const Real*>();
+      } else if (var.name=="total_sky_downward_shortwave_flux_at_top_of_atmosphere") {
+        const auto SW_flux_dn = get_field_in("SW_flux_dn").get_view<const Real**>();
+        src_2d = Kokkos::subview(SW_flux_dn,Kokkos::ALL,0);
+      } else {
+        EKAT_ERROR_MSG ("Error! Unsupported input for native ML correction model.\n"
+            " - input name: " + var.name + "\n");
+      }
+    }
+
+    const int expected = is_3d ? nlev : 1;
+    EKAT_REQUIRE_MSG (var.size==expected,
+        "Error! Wrong number of features for ML correction model input.\n"
+        " - input name: " + var.name + "\n"
+        " - expected  : " + std::to_string(expected) + "\n"
+        " - found     : " + std::to_string(var.size) + "\n");
+
+    if (is_3d) {
+      Kokkos::parallel_for("MLCorrection::gather_3d",RangePolicy(0,ncol*nlev),
+                           KOKKOS_LAMBDA(const int idx) {
+        const int icol = idx / nlev;
+        const int ilev = idx % nlev;
+        x(icol,off+ilev) = src_3d(icol,ilev);
+      });
+    } else {
+      Kokkos::parallel_for("MLCorrection::gather_2d",RangePolicy(0,ncol),
+                           KOKKOS_LAMBDA(const int icol) {
+        x(icol,off) = src_2d(icol);
+      });
+    }
+  }
+
+  model.predict(x,y);
+
+  // Scatter the outputs back to the state. Tendencies are integrated over dt,
+  // while surface fluxes overwrite the current values.
+  for (const auto& var : model.outputs()) {
+    const int off = var.offset;
+    KT::sview<Real**> dst_3d;
+    KT::sview<Real*>  dst_2d;
+    bool is_3d = true;
+    if (var.name=="dQ1") {
+      dst_3d = get_field_out("T_mid").get_strided_view<Real**>();
+    } else if (var.name=="dQ2") {
+      dst_3d = get_field_out("qv").get_strided_view<Real**>();
+    } else if (var.name=="dQu" or var.name=="dQxwind") {
+      dst_3d = get_field_out("horiz_winds").get_component(0).get_strided_view<Real**>();
+    } else if (var.name=="dQv" or var.name=="dQywind") {
+      dst_3d = get_field_out("horiz_winds").get_component(1).get_strided_view<Real**>();
+    } else {
+      is_3d = false;
+      if (var.name=="net_shortwave_sfc_flux_via_transmissivity") {
+        dst_2d = get_field_out("sfc_flux_sw_net").get_strided_view<Real*>();
+      } else if (var.name=="override_for_time_adjusted_total_sky_downward_longwave_flux_at_surface") {
+        dst_2d = get_field_out("sfc_flux_lw_dn").get_strided_view<Real*>();
+      } else {
+        EKAT_ERROR_MSG ("Error! Unsupported output for native ML correction model.\n"
+            " - output name: " + var.name + "\n");
+      }
+    }
+
+    const int expected = is_3d ? nlev : 1;
+    EKAT_REQUIRE_MSG (var.size==expected,
+        "Error! Wrong number of features for ML correction model output.\n"
+        " - output name: " + var.name + "\n"
+        " - expected   : " + std::to_string(expected) + "\n"
+        " - found      : " + std::to_string(var.size) + "\n");
+
+    if (is_3d) {
+      Kokkos::parallel_for("MLCorrection::apply_tend",RangePolicy(0,ncol*nlev),
+                           KOKKOS_LAMBDA(const int idx) {
+        const int icol = idx / nlev;
+        const int ilev = idx % nlev;
+        dst_3d(icol,ilev) += y(icol,off+ilev)*dt;
+      });
+    } else {
+      Kokkos::parallel_for("MLCorrection::overwrite_2d",RangePolicy(0,ncol),
+                           KOKKOS_LAMBDA(const int icol) {
+        dst_2d(icol) = y(icol,off);
+      });
+    }
+  }
+  Kokkos::fence();
+}
+
 // =========================================================================================
 void MLCorrection::finalize_impl() {
   // Do nothing
@@ -16,6 +16,7 @@
 #include "share/grid/mesh_free_grids_manager.hpp"
 #include "share/grid/point_grid.hpp"
 #include "share/util/eamxx_time_stamp.hpp"
+#include "physics/ml_correction/eamxx_ml_correction_native_model.hpp"
 
 namespace scream {
 
@@ -42,6 +43,10 @@ class MLCorrection : public AtmosphereProcess {
   // Set the grid
   void set_grids(const std::shared_ptr<const GridsManager> grids_manager);
 
+  // Evaluate one model with the in-process native backend, on device.
+  // CUDA requires the parent fcn of a KOKKOS_LAMBDA to have public access
+  void apply_native_model(const MLCorrectionNativeModel& model, const double dt);
+
  protected:
   // The three main overrides for the subcomponent
   void initialize_impl(const RunType run_type);
@@ -49,6 +54,12 @@ class MLCorrection : public AtmosphereProcess {
   void finalize_impl();
   void apply_tendency(Field& base, const Field& next, const int dt);
 
+  // Evaluate the models with the python interpreter, on host
+  void run_python(const double dt);
+
+  // Evaluate the models with the in-process native backend, on device
+  void run_native(const double dt);
+
   std::shared_ptr<const AbstractGrid>   m_grid;
   // Keep track of field dimensions and the iteration count
   Int m_num_cols;
@@ -60,6 +71,14 @@ class MLCorrection : public AtmosphereProcess {
   std::string m_ML_model_path_sfc_fluxes;
   std::vector<std::string> m_fields_ml_output_variables;
   bool m_ML_correction_unit_test;
+  // Either "python" (default) or "native"
+  std::string m_backend;
+  std::shared_ptr<MLCorrectionNativeModel> m_native_model_tq;
+  std::shared_ptr<MLCorrectionNativeModel> m_native_model_uv;
+  std::shared_ptr<MLCorrectionNativeModel> m_native_model_sfc_fluxes;
+  MLCorrectionNativeModel::view_1d<Real> m_native_inputs;
+  MLCorrectionNativeModel::view_1d<Real> m_native_outputs;
+  MLCorrectionNativeModel::view_1d<Real> m_cos_zenith;
   pybind11::module py_correction;
   pybind11::object ML_model_tq;
   pybind11::object ML_model_uv;
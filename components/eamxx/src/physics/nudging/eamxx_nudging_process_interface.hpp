@@ -35,6 +35,9 @@ public:
   // The name of the subcomponent
   std::string name () const override { return "Nudging"; }
 
+  // The time interpolation of nudging data can only move forward in time
+  bool supports_state_reset () const override { return false; }
+
   // Set the grid
   void set_grids (const std::shared_ptr<const GridsManager> grids_manager) override;
 
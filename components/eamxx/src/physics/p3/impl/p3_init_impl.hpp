@@ -3,13 +3,127 @@
 
 #include "p3_functions.hpp" // for ETI only but harmless for GPU
 
+#include <cstdint>
+#include <cstring>
 #include <fstream>
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 namespace scream {
 namespace p3 {
 
 namespace {
 
+// Extension of binary table files, which are only valid for the precision they were written in
+inline std::string bin_extension ()
+{
+#ifdef SCREAM_DOUBLE_PRECISION
+  return "8";
+#else
+  return "4";
+#endif
+}
+
+/*
+ * Binary version of the ice lookup tables.
+ *
+ * The file is a 64-byte header, followed by the ice table and by the
+ * collection table, stored exactly as they are laid out in memory (in
+ * the build precision, with the log10 of the collection quantities already
+ * taken). The file is mapped in memory and copied straight into the table
+ * views, which is much faster than parsing the text table at every init.
+ * The binary file is written by p3_init when write_tables=true (see
+ * p3_tables_setup), and is ignored if it does not match the expected
+ * version, precision, or table sizes.
+ */
+struct IceTablesBinHeader {
+  char    magic[8];      // "P3ICETAB"
+  char    version[16];   // table version, e.g. "4.1.1"
+  int32_t scalar_size;   // sizeof(Scalar)
+  int32_t dims[6];       // densize, rimsize, isize, ice_table_size, rcollsize, collect_table_size
+  char    pad[12];
+};
+static_assert(sizeof(IceTablesBinHeader)==64, "Error! Unexpected padding in IceTablesBinHeader.\n");
+
+template <typename IceH, typename CollH>
+IceTablesBinHeader make_ice_tables_bin_header (const char* p3_version)
+{
+  IceTablesBinHeader h;
+  std::memset(&h,0,sizeof(h));
+  std::memcpy(h.magic,"P3ICETAB",8);
+  std::strncpy(h.version,p3_version,sizeof(h.version)-1);
+  h.scalar_size = sizeof(typename IceH::non_const_value_type);
+  h.dims[0] = IceH::static_extent(0);
+  h.dims[1] = IceH::static_extent(1);
+  h.dims[2] = IceH::static_extent(2);
+  h.dims[3] = IceH::static_extent(3);
+  h.dims[4] = CollH::static_extent(3);
+  h.dims[5] = CollH::static_extent(4);
+  return h;
+}
+
+// Fill the host tables from the binary file. Returns false (leaving the
+// tables untouched) if the file is missing or does not match.
+template <typename IceH, typename CollH>
+bool read_ice_tables_bin (const std::string& filename, const char* p3_version,
+                          const IceH& ice_table_vals_h, const CollH& collect_table_vals_h)
+{
+  using S = typename IceH::non_const_value_type;
+  const size_t ice_bytes  = ice_table_vals_h.size()*sizeof(S);
+  const size_t coll_bytes = collect_table_vals_h.size()*sizeof(S);
+  const size_t file_bytes = sizeof(IceTablesBinHeader) + ice_bytes + coll_bytes;
+
+  const int fd = open(filename.c_str(), O_RDONLY);
+  if (fd<0) {
+    return false;
+  }
+  struct stat st;
+  if (fstat(fd,&st)!=0 || static_cast<size_t>(st.st_size)!=file_bytes) {
+    close(fd);
+    return false;
+  }
+  void* map = mmap(nullptr, file_bytes, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (map==MAP_FAILED) {
+    return false;
+  }
+
+  const char* bytes = static_cast<const char*>(map);
+  const auto expected = make_ice_tables_bin_header<IceH,CollH>(p3_version);
+  const bool match = std::memcmp(bytes,&expected,sizeof(IceTablesBinHeader))==0;
+  if (match) {
+    bytes += sizeof(IceTablesBinHeader);
+    std::memcpy(ice_table_vals_h.data(), bytes, ice_bytes);
+    std::memcpy(collect_table_vals_h.data(), bytes+ice_bytes, coll_bytes);
+  }
+  munmap(map, file_bytes);
+  return match;
+}
+
+template <typename IceT, typename CollT>
+void write_ice_tables_bin (const bool masterproc, const std::string& filename, const char* p3_version,
+                           const IceT& ice_table_vals, const CollT& collect_table_vals)
+{
+  if (masterproc) {
+    std::cout << "Writing ice lookup tables in binary file: " << filename << std::endl;
+  }
+
+  const auto ice_table_vals_h     = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), ice_table_vals);
+  const auto collect_table_vals_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), collect_table_vals);
+
+  using S = typename IceT::non_const_value_type;
+  const auto header = make_ice_tables_bin_header<decltype(ice_table_vals_h),decltype(collect_table_vals_h)>(p3_version);
+
+  std::ofstream out(filename, std::ios::binary);
+  EKAT_REQUIRE_MSG (out.good(), "Error! Could not open " << filename << " for writing.\n");
+  out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  out.write(reinterpret_cast<const char*>(ice_table_vals_h.data()), sizeof(S)*ice_table_vals_h.size());
+  out.write(reinterpret_cast<const char*>(collect_table_vals_h.data()), sizeof(S)*collect_table_vals_h.size());
+}
+
 template <typename S, typename IceT, typename CollT>
 void read_ice_lookup_tables(const bool masterproc, const char* p3_lookup_base, const char* p3_version, IceT& ice_table_vals, CollT& collect_table_vals, int densize, int rimsize, int isize, int rcollsize)
 {
@@ -23,10 +137,23 @@ void read_ice_lookup_tables(const bool masterproc, const char* p3_lookup_base, c
   const auto collect_table_vals_h = Kokkos::create_mirror_view(collect_table_vals_d);
 
   //
-  // read in ice microphysics table into host views. We always read these as doubles.
+  // read in ice microphysics table into host views. If the binary version of the
+  // tables is available, use it, otherwise parse the text file (always reading as doubles).
   //
 
   std::string filename = std::string(p3_lookup_base) + std::string(p3_version);
+  const std::string bin_filename = filename + ".bin" + bin_extension();
+
+  if (read_ice_tables_bin(bin_filename, p3_version, ice_table_vals_h, collect_table_vals_h)) {
+    if (masterproc) {
+      std::cout << "Reading ice lookup tables in binary file: " << bin_filename << std::endl;
+    }
+    Kokkos::deep_copy(ice_table_vals_d, ice_table_vals_h);
+    Kokkos::deep_copy(collect_table_vals_d, collect_table_vals_h);
+    ice_table_vals    = ice_table_vals_d;
+    collect_table_vals = collect_table_vals_d;
+    return;
+  }
 
   if (masterproc) {
     std::cout << "Reading ice lookup tables in file: " << filename << std::endl;
@@ -217,13 +344,7 @@ void io_impl(const bool masterproc, const char* dir, MuRT& mu_r_table_vals, VNT&
     std::cout << (IsRead ? "Reading" : "Writing") << " lookup (non-ice) tables in dir " << dir << std::endl;
   }
 
-  std::string extension =
-#ifdef SCREAM_DOUBLE_PRECISION
-    "8"
-#else
-    "4"
-#endif
-    ;
+  const std::string extension = bin_extension();
 
   // Get host views
   auto mu_r_table_vals_h  = Kokkos::create_mirror_view(mu_r_table_vals);
@@ -328,6 +449,9 @@ typename Functions<S,D>::P3LookupTables Functions<S,D>
   // p3_init_a (reads ice_table, collect_table)
   read_ice_lookup_tables<S>(masterproc, p3_lookup_base, version, lookup_tables.ice_table_vals, lookup_tables.collect_table_vals, P3C::densize, P3C::rimsize, P3C::isize, P3C::rcollsize);
   if (write_tables) {
+    // binary version of the ice tables, for faster reads at the next init
+    write_ice_tables_bin(masterproc, std::string(p3_lookup_base) + version + ".bin" + bin_extension(),
+                         version, lookup_tables.ice_table_vals, lookup_tables.collect_table_vals);
     //p3_init_b (computes tables mu_r_table, revap_table, vn_table, vm_table)
     compute_tables<S, P3C>(masterproc, lookup_tables.mu_r_table_vals, lookup_tables.vn_table_vals, lookup_tables.vm_table_vals, lookup_tables.revap_table_vals);
     write_computed_tables(masterproc, dir, lookup_tables.mu_r_table_vals, lookup_tables.vn_table_vals, lookup_tables.vm_table_vals, lookup_tables.revap_table_vals);
@@ -79,6 +79,11 @@ void Functions<S,D>
   tab.dumjj -= 1;
   tab.dumii -= 1;
   tab.dumzz -= 1;
+
+  // interpolation weights, shared by all the quantities looked up at this point
+  tab.w1 = tab.dum1 - Spack(tab.dumi) - 1;
+  tab.w4 = tab.dum4 - Spack(tab.dumii) - 1;
+  tab.w5 = tab.dum5 - Spack(tab.dumjj) - 1;
 }
 
 template <typename S, typename D>
@@ -114,6 +119,9 @@ void Functions<S,D>
 
   // adjust for 0-based indexing
   tab.dumj -= 1;
+
+  // interpolation weight, shared by all the quantities looked up at this point
+  tab.w3 = tab.dum3 - Spack(tab.dumj) - 1;
 }
 
 template <typename S, typename D>
@@ -122,41 +130,47 @@ typename Functions<S,D>::Spack Functions<S,D>
 ::apply_table_ice(const int& idx, const view_ice_table& ice_table_vals, const TableIce& tab,
                   const Smask& context)
 {
-  using ekat::index;
-
   Spack proc;
-  IntSmallPack idxpk(idx);
 
   if (!context.any()) return proc;
 
-  // get value at current density index
+  // All the quantities at a given (density, rime fraction, size) index are
+  // contiguous, so the 8 corners of the cell are 4 pairs of adjacent rows,
+  // at fixed offsets from the first corner. We compute the offset of the
+  // first corner once, rather than gathering each corner with a 4d index.
+  constexpr int si  = P3C::ice_table_size;
+  constexpr int sii = P3C::isize*si;
+  constexpr int sjj = P3C::rimsize*sii;
+  const Scalar* data = ice_table_vals.data();
 
-  // first interpolate for current rimed fraction index
-  auto iproc1 = index(ice_table_vals, tab.dumjj, tab.dumii, tab.dumi, idxpk) + (tab.dum1-Spack(tab.dumi)-1) *
-    (index(ice_table_vals, tab.dumjj, tab.dumii, tab.dumi+1, idxpk) - index(ice_table_vals, tab.dumjj, tab.dumii, tab.dumi, idxpk));
+  for (int s = 0; s < Spack::n; ++s) {
+    const Scalar* v = data + tab.dumjj[s]*sjj + tab.dumii[s]*sii + tab.dumi[s]*si + idx;
+    const Scalar w1 = tab.w1[s];
+    const Scalar w4 = tab.w4[s];
 
-  // linearly interpolate to get process rates for rimed fraction index + 1
-  auto gproc1 = index(ice_table_vals, tab.dumjj, tab.dumii+1, tab.dumi, idxpk) + (tab.dum1-Spack(tab.dumi)-1) *
-    (index(ice_table_vals, tab.dumjj, tab.dumii+1, tab.dumi+1, idxpk) - index(ice_table_vals, tab.dumjj, tab.dumii+1, tab.dumi, idxpk));
+    // get value at current density index
 
-  const auto tmp1   = iproc1 + (tab.dum4-Spack(tab.dumii)-1) * (gproc1-iproc1);
+    // first interpolate for current rimed fraction index
+    Scalar iproc1 = v[0] + w1 * (v[si] - v[0]);
 
-  // get value at density index + 1
+    // linearly interpolate to get process rates for rimed fraction index + 1
+    Scalar gproc1 = v[sii] + w1 * (v[sii+si] - v[sii]);
 
-  // first interpolate for current rimed fraction index
+    const Scalar tmp1 = iproc1 + w4 * (gproc1-iproc1);
 
-  iproc1 = index(ice_table_vals, tab.dumjj+1, tab.dumii, tab.dumi, idxpk) + (tab.dum1-Spack(tab.dumi)-1) *
-    (index(ice_table_vals, tab.dumjj+1, tab.dumii, tab.dumi+1, idxpk) - index(ice_table_vals, tab.dumjj+1, tab.dumii, tab.dumi, idxpk));
+    // get value at density index + 1
 
-  // linearly interpolate to get process rates for rimed fraction index + 1
+    // first interpolate for current rimed fraction index
+    iproc1 = v[sjj] + w1 * (v[sjj+si] - v[sjj]);
 
-  gproc1 = index(ice_table_vals, tab.dumjj+1, tab.dumii+1, tab.dumi, idxpk) + (tab.dum1-Spack(tab.dumi)-1) *
-    (index(ice_table_vals, tab.dumjj+1, tab.dumii+1, tab.dumi+1, idxpk)-index(ice_table_vals, tab.dumjj+1, tab.dumii+1, tab.dumi, idxpk));
+    // linearly interpolate to get process rates for rimed fraction index + 1
+    gproc1 = v[sjj+sii] + w1 * (v[sjj+sii+si] - v[sjj+sii]);
 
-  const auto tmp2 = iproc1+(tab.dum4 - Spack(tab.dumii) - 1) * (gproc1-iproc1);
+    const Scalar tmp2 = iproc1 + w4 * (gproc1-iproc1);
 
-  // get final process rate
-  proc = tmp1 + (tab.dum5 - Spack(tab.dumjj) - 1) * (tmp2-tmp1);
+    // get final process rate
+    proc[s] = tmp1 + tab.w5[s] * (tmp2-tmp1);
+  }
   return proc;
 }
 
@@ -167,76 +181,44 @@ typename Functions<S,D>::Spack Functions<S,D>
                    const TableIce& ti, const TableRain& tr,
                    const Smask& context)
 {
-  using ekat::index;
-
   Spack proc;
-  IntSmallPack idxpk(idx);
 
   if (!context.any()) return proc;
 
-  // current density index
-
-  // current rime fraction index
-  auto dproc1  = index(collect_table_vals, ti.dumjj, ti.dumii, ti.dumi, tr.dumj, idxpk) +
-    (ti.dum1 - Spack(ti.dumi) - 1) *
-    (index(collect_table_vals, ti.dumjj, ti.dumii, ti.dumi+1, tr.dumj, idxpk) -
-     index(collect_table_vals, ti.dumjj, ti.dumii, ti.dumi, tr.dumj, idxpk));
-
-  auto dproc2  = index(collect_table_vals, ti.dumjj, ti.dumii, ti.dumi, tr.dumj+1, idxpk) +
-    (ti.dum1 - Spack(ti.dumi) - 1)*
-    (index(collect_table_vals, ti.dumjj, ti.dumii, ti.dumi+1, tr.dumj+1, idxpk) -
-     index(collect_table_vals, ti.dumjj, ti.dumii, ti.dumi, tr.dumj+1, idxpk));
-
-  auto iproc1  = dproc1+(tr.dum3 - Spack(tr.dumj) - 1) * (dproc2 - dproc1);
-
-  // rime fraction index + 1
-
-  dproc1  = index(collect_table_vals, ti.dumjj, ti.dumii+1, ti.dumi, tr.dumj, idxpk) +
-    (ti.dum1 - Spack(ti.dumi) - 1) *
-    (index(collect_table_vals, ti.dumjj, ti.dumii+1, ti.dumi+1, tr.dumj, idxpk) -
-     index(collect_table_vals, ti.dumjj, ti.dumii+1, ti.dumi, tr.dumj, idxpk));
-
-  dproc2  = index(collect_table_vals, ti.dumjj, ti.dumii+1, ti.dumi, tr.dumj+1, idxpk) +
-    (ti.dum1 - Spack(ti.dumi) - 1) *
-    (index(collect_table_vals, ti.dumjj, ti.dumii+1, ti.dumi+1, tr.dumj+1, idxpk) -
-     index(collect_table_vals, ti.dumjj, ti.dumii+1, ti.dumi, tr.dumj+1, idxpk));
-
-  auto gproc1  = dproc1+(tr.dum3 - Spack(tr.dumj) - 1) * (dproc2-dproc1);
-  const auto tmp1    = iproc1+(ti.dum4 - Spack(ti.dumii) - 1) * (gproc1-iproc1);
-
-  // density index + 1
-
-  // current rime fraction index
-
-  dproc1  = index(collect_table_vals, ti.dumjj+1, ti.dumii, ti.dumi, tr.dumj, idxpk) +
-    (ti.dum1 - Spack(ti.dumi) - 1)*
-    (index(collect_table_vals, ti.dumjj+1, ti.dumii, ti.dumi+1, tr.dumj, idxpk) -
-     index(collect_table_vals, ti.dumjj+1, ti.dumii, ti.dumi, tr.dumj, idxpk));
-
-  dproc2  = index(collect_table_vals, ti.dumjj+1, ti.dumii, ti.dumi, tr.dumj+1, idxpk) +
-    (ti.dum1 - Spack(ti.dumi) - 1) *
-    (index(collect_table_vals, ti.dumjj+1, ti.dumii, ti.dumi+1, tr.dumj+1, idxpk) -
-     index(collect_table_vals, ti.dumjj+1, ti.dumii, ti.dumi, tr.dumj+1, idxpk));
-
-  iproc1  = dproc1 + (tr.dum3 - Spack(tr.dumj) - 1) * (dproc2-dproc1);
-
-  // rime fraction index + 1
-
-  dproc1  = index(collect_table_vals, ti.dumjj+1, ti.dumii+1, ti.dumi, tr.dumj, idxpk) +
-    (ti.dum1 - Spack(ti.dumi) - 1)*
-    (index(collect_table_vals, ti.dumjj+1, ti.dumii+1, ti.dumi+1, tr.dumj, idxpk) -
-     index(collect_table_vals, ti.dumjj+1, ti.dumii+1, ti.dumi, tr.dumj, idxpk));
-
-  dproc2  = index(collect_table_vals, ti.dumjj+1, ti.dumii+1, ti.dumi, tr.dumj+1, idxpk) +
-    (ti.dum1 - Spack(ti.dumi) - 1) *
-    (index(collect_table_vals, ti.dumjj+1, ti.dumii+1, ti.dumi+1, tr.dumj+1, idxpk) -
-     index(collect_table_vals, ti.dumjj+1, ti.dumii+1, ti.dumi, tr.dumj+1, idxpk));
-
-  gproc1  = dproc1 + (tr.dum3 - Spack(tr.dumj) - 1) * (dproc2-dproc1);
-  const auto tmp2    = iproc1 + (ti.dum4 - Spack(ti.dumii) - 1) * (gproc1-iproc1);
-
-  // interpolate over density to get final values
-  proc    = tmp1+(ti.dum5 - Spack(ti.dumjj) - 1) * (tmp2-tmp1);
+  // As in apply_table_ice, the 16 corners of the cell are read at fixed
+  // offsets from the first one.
+  constexpr int sj  = P3C::collect_table_size;
+  constexpr int si  = P3C::rcollsize*sj;
+  constexpr int sii = P3C::isize*si;
+  constexpr int sjj = P3C::rimsize*sii;
+  const Scalar* data = collect_table_vals.data();
+
+  for (int s = 0; s < Spack::n; ++s) {
+    const Scalar* v = data + ti.dumjj[s]*sjj + ti.dumii[s]*sii + ti.dumi[s]*si + tr.dumj[s]*sj + idx;
+    const Scalar w1 = ti.w1[s];
+    const Scalar w3 = tr.w3[s];
+    const Scalar w4 = ti.w4[s];
+
+    // Interpolate over the ice size and rain size indices, starting at offset o
+    auto interp_ij = [&](const int o) {
+      const Scalar dproc1 = v[o]    + w1 * (v[o+si]    - v[o]);
+      const Scalar dproc2 = v[o+sj] + w1 * (v[o+si+sj] - v[o+sj]);
+      return dproc1 + w3 * (dproc2 - dproc1);
+    };
+
+    // current density index
+    Scalar iproc1 = interp_ij(0);          // current rime fraction index
+    Scalar gproc1 = interp_ij(sii);        // rime fraction index + 1
+    const Scalar tmp1 = iproc1 + w4 * (gproc1-iproc1);
+
+    // density index + 1
+    iproc1 = interp_ij(sjj);               // current rime fraction index
+    gproc1 = interp_ij(sjj+sii);           // rime fraction index + 1
+    const Scalar tmp2 = iproc1 + w4 * (gproc1-iproc1);
+
+    // interpolate over density to get final values
+    proc[s] = tmp1 + ti.w5[s] * (tmp2-tmp1);
+  }
   return proc;
 }
 
@@ -373,14 +373,20 @@ struct Functions
     Spack rdumii, rdumjj;
   };
 
+  // The w* members are the interpolation weights along each table dimension
+  // (isize, rimsize, densize, rcollsize). They are computed once in
+  // lookup_ice/lookup_rain, and shared by all the apply_table_* calls that
+  // interpolate quantities at the same point.
   struct TableIce {
     IntSmallPack dumi, dumjj, dumii, dumzz;
     Spack dum1, dum4, dum5, dum6;
+    Spack w1, w4, w5;
   };
 
   struct TableRain {
     IntSmallPack dumj;
     Spack dum3;
+    Spack w3;
   };
 
   //
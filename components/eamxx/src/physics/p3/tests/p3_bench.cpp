@@ -0,0 +1,100 @@
+#include "share/eamxx_types.hpp"
+#include "share/eamxx_session.hpp"
+#include "physics/share/physics_bench_utils.hpp"
+
+#include "p3_functions.hpp"
+#include "p3_main_wrap.hpp"
+#include "p3_data.hpp"
+#include "p3_ic_cases.hpp"
+
+#include <iostream>
+
+namespace {
+using namespace scream;
+using namespace scream::p3;
+using P3F = Functions<Real, DefaultDevice>;
+
+/*
+ * p3_bench times p3_main on synthetic columns. Columns start from the "mixed"
+ * initial condition, with a per-column perturbation of temperature and of the
+ * hydrometeor mass, so that columns take different branches in the process rates
+ * (as they would in a real run) rather than being identical copies.
+ *
+ * The same source is compiled against p3 and (if small kernels are off) against
+ * p3_sk, so that p3_bench and p3_sk_bench compare the monolithic and dispatch paths.
+ */
+
+void perturb_columns (P3Data& d) {
+  for (Int i = 0; i < d.ncol; ++i) {
+    const Real fq = 0.5 + (i % 17) / 16.0;
+    const Real dt = ((i % 7) - 3) * 0.5;
+    for (Int k = 0; k < d.nlev; ++k) {
+      d.qc(i,k) *= fq;
+      d.qr(i,k) *= fq;
+      d.qi(i,k) *= fq;
+      d.qm(i,k) *= fq;
+      d.th_atm(i,k) += dt;
+      d.t_prev(i,k) += dt;
+    }
+  }
+}
+
+} // namespace anon
+
+int main (int argc, char** argv) {
+  if (argc > 1 && std::string(argv[1])=="-h") {
+    std::cout <<
+      argv[0] << " [options]\n"
+      "Options:\n" << bench::common_usage() <<
+      "  -dt <seconds>       Length of timestep. Default=300.\n"
+      "  --predict-nc <y|n>  Predict nc. Default=y.\n";
+    return 0;
+  }
+
+  Real dt = 300;
+  bool predict_nc = true;
+  const auto cfg = bench::parse_args(argc, argv, [&](int& i) {
+    const std::string a = argv[i];
+    if (a=="-dt" || a=="--dt") {
+      bench::expect_another_arg(i, argc);
+      dt = std::atof(argv[++i]);
+    } else if (a=="-pn" || a=="--predict-nc") {
+      bench::expect_another_arg(i, argc);
+      predict_nc = std::string(argv[++i])!="n";
+    }
+  });
+  // The mixed IC places clouds in the bottom 20 levels
+  EKAT_REQUIRE_MSG (cfg.nlev>=20, "Error! p3_bench needs at least 20 levels.\n");
+
+  scream::initialize_eamxx_session(argc, argv);
+  {
+    P3F::p3_init();
+
+    bench::Timings timings;
+    for (int r = -cfg.nwarm; r < cfg.nrep; ++r) {
+      const auto d = ic::Factory::create(ic::Factory::mixed, cfg.ncol, cfg.nlev);
+      d->dt = dt;
+      d->it = cfg.nsteps;
+      d->do_predict_nc = predict_nc;
+      d->do_prescribed_CCN = false;
+      perturb_columns(*d);
+
+      Int microsec = 0;
+      for (int it = 0; it < cfg.nsteps; ++it) {
+        microsec += p3_main_wrap(*d);
+      }
+      if (r >= 0) {
+        timings.add("p3_main", 1e-6*microsec);
+      }
+    }
+
+#ifdef SCREAM_P3_SMALL_KERNELS
+    timings.report("P3 (small kernels)", cfg, SCREAM_SMALL_PACK_SIZE);
+#else
+    timings.report("P3", cfg, SCREAM_SMALL_PACK_SIZE);
+#endif
+  }
+  scream::finalize_eamxx_session();
+
+  return 0;
+}
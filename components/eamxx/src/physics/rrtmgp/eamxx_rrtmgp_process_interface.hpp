@@ -66,6 +66,7 @@ public:
   void initialize_impl (const RunType run_type);
   void run_impl        (const double dt);
   void finalize_impl   ();
+  void reset_state_impl () { m_force_run_on_next_step = true; }
 
   // Keep track of number of columns and levels
   int m_ncol;
@@ -0,0 +1,113 @@
+#ifndef SCREAM_PHYSICS_BENCH_UTILS_HPP
+#define SCREAM_PHYSICS_BENCH_UTILS_HPP
+
+#include <ekat/ekat_assert.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace scream {
+namespace bench {
+
+/*
+ * Small utilities shared by the physics micro-benchmarks (p3_bench, shoc_bench, gw_bench).
+ *
+ * Each benchmark runs a kernel for nsteps steps on ncol synthetic columns, and repeats
+ * this nrep times. A Timings object collects the elapsed time of each repetition for
+ * each kernel, and reports mean/min/max/stddev as well as the throughput in
+ * column-steps per second (computed from the mean time).
+ */
+
+struct Config {
+  int ncol   = 64;
+  int nlev   = 72;
+  int nsteps = 1;
+  int nrep   = 10;
+  int nwarm  = 1;
+};
+
+inline void expect_another_arg (const int i, const int argc) {
+  EKAT_REQUIRE_MSG(i != argc-1, "Expected another cmd-line arg.");
+}
+
+// Parses the options common to all benchmarks, leaving the others to the caller
+// (extra(i) must return true if it consumed argv[i], possibly advancing i).
+template<typename ExtraArgs>
+Config parse_args (int argc, char** argv, const ExtraArgs& extra) {
+  Config c;
+  for (int i = 1; i < argc; ++i) {
+    const std::string a = argv[i];
+    auto next_int = [&]() {
+      expect_another_arg(i, argc);
+      return std::atoi(argv[++i]);
+    };
+    if      (a=="-i" || a=="--ncol")   { c.ncol   = next_int(); }
+    else if (a=="-k" || a=="--nlev")   { c.nlev   = next_int(); }
+    else if (a=="-s" || a=="--steps")  { c.nsteps = next_int(); }
+    else if (a=="-r" || a=="--repeat") { c.nrep   = next_int(); }
+    else if (a=="-w" || a=="--warmup") { c.nwarm  = next_int(); }
+    else { extra(i); }
+  }
+  EKAT_REQUIRE_MSG (c.ncol>0 && c.nlev>0 && c.nsteps>0 && c.nrep>0 && c.nwarm>=0,
+      "Error! Invalid benchmark configuration.\n"
+      " - ncol  : " + std::to_string(c.ncol) + "\n"
+      " - nlev  : " + std::to_string(c.nlev) + "\n"
+      " - steps : " + std::to_string(c.nsteps) + "\n"
+      " - repeat: " + std::to_string(c.nrep) + "\n"
+      " - warmup: " + std::to_string(c.nwarm) + "\n");
+  return c;
+}
+
+inline const char* common_usage () {
+  return
+    "  -i <cols>           Number of columns. Default=64.\n"
+    "  -k <nlev>           Number of vertical levels. Default=72.\n"
+    "  -s <steps>          Number of steps per repetition. Default=1.\n"
+    "  -r <repeat>         Number of timed repetitions. Default=10.\n"
+    "  -w <warmup>         Number of untimed repetitions. Default=1.\n";
+}
+
+class Timings {
+public:
+  // Kernels are reported in the order they were first timed
+  void add (const std::string& kernel, const double seconds) {
+    if (m_samples.find(kernel)==m_samples.end()) {
+      m_order.push_back(kernel);
+    }
+    m_samples[kernel].push_back(seconds);
+  }
+
+  void report (const std::string& package, const Config& c, const int packn) const {
+    printf("%s benchmark: ncol=%d, nlev=%d, steps=%d, repeat=%d, packn=%d\n",
+           package.c_str(), c.ncol, c.nlev, c.nsteps, c.nrep, packn);
+    printf("%-32s %11s %11s %11s %11s %14s\n",
+           "kernel", "mean[s]", "min[s]", "max[s]", "stddev[s]", "col-steps/s");
+    for (const auto& k : m_order) {
+      const auto& s = m_samples.at(k);
+      const int n = s.size();
+      double mean = 0, var = 0;
+      for (auto t : s) mean += t;
+      mean /= n;
+      for (auto t : s) var += (t-mean)*(t-mean);
+      const double stddev = n>1 ? std::sqrt(var/(n-1)) : 0;
+      const auto mm = std::minmax_element(s.begin(),s.end());
+      const double rate = mean>0 ? double(c.ncol)*c.nsteps/mean : 0;
+      printf("%-32s %11.3e %11.3e %11.3e %11.3e %14.3e\n",
+             k.c_str(), mean, *mm.first, *mm.second, stddev, rate);
+    }
+  }
+
+private:
+  std::vector<std::string> m_order;
+  std::map<std::string,std::vector<double>> m_samples;
+};
+
+} // namespace bench
+} // namespace scream
+
+#endif // SCREAM_PHYSICS_BENCH_UTILS_HPP
@@ -33,10 +33,12 @@ struct Functions
   using Scalar = ScalarT;
   using Device = DeviceT;
 
+  // Pack sizes are set by the Scalar type, to match the packs of the
+  // physics packages instantiated with the same Scalar (see pack_size_for).
   template <typename S>
-  using BigPack = ekat::Pack<Scalar,SCREAM_PACK_SIZE>;
+  using BigPack = ekat::Pack<Scalar,pack_size_for<Scalar,SCREAM_PACK_SIZE>()>;
   template <typename S>
-  using SmallPack = ekat::Pack<S,SCREAM_SMALL_PACK_SIZE>;
+  using SmallPack = ekat::Pack<S,pack_size_for<Scalar,SCREAM_SMALL_PACK_SIZE>()>;
 
   using IntSmallPack = SmallPack<Int>;
   using Pack         = BigPack<Scalar>;
@@ -12,5 +12,10 @@ namespace physics {
 
 template struct Functions<Real,DefaultDevice>;
 
+#ifdef EAMXX_ENABLE_MIXED_PRECISION_PHYSICS
+// Reduced precision version, for physics processes running in float
+template struct Functions<float,DefaultDevice>;
+#endif
+
 } // namespace physics
 } // namespace scream
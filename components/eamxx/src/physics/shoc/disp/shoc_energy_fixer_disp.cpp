@@ -15,14 +15,14 @@ void Functions<Real,DefaultDevice>
   const Int&                   nadv,
   const view_2d<const Spack>&  zt_grid,
   const view_2d<const Spack>&  zi_grid,
-  const view_1d<const Scalar>& se_b,
-  const view_1d<const Scalar>& ke_b,
-  const view_1d<const Scalar>& wv_b,
-  const view_1d<const Scalar>& wl_b,
-  const view_1d<const Scalar>& se_a,
-  const view_1d<const Scalar>& ke_a,
-  const view_1d<const Scalar>& wv_a,
-  const view_1d<const Scalar>& wl_a,
+  const view_1d<const Accum>& se_b,
+  const view_1d<const Accum>& ke_b,
+  const view_1d<const Accum>& wv_b,
+  const view_1d<const Accum>& wl_b,
+  const view_1d<const Accum>& se_a,
+  const view_1d<const Accum>& ke_a,
+  const view_1d<const Accum>& wv_a,
+  const view_1d<const Accum>& wl_a,
   const view_1d<const Scalar>& wthl_sfc,
   const view_1d<const Scalar>& wqw_sfc,
   const view_2d<const Spack>&  rho_zt,
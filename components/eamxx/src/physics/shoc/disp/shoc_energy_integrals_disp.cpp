@@ -16,10 +16,10 @@ void Functions<Real,DefaultDevice>
   const view_2d<const Spack>& rcm,
   const uview_2d<const Spack>& u_wind,
   const uview_2d<const Spack>& v_wind,
-  const view_1d<Scalar>& se_b,
-  const view_1d<Scalar>& ke_b,
-  const view_1d<Scalar>& wv_b,
-  const view_1d<Scalar>& wl_b)
+  const view_1d<Accum>& se_b,
+  const view_1d<Accum>& ke_b,
+  const view_1d<Accum>& wv_b,
+  const view_1d<Accum>& wl_b)
 {
   using ExeSpace = typename KT::ExeSpace;
 
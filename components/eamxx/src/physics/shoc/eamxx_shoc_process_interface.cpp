@@ -16,6 +16,16 @@ SHOCMacrophysics::SHOCMacrophysics (const ekat::Comm& comm,const ekat::Parameter
   /* Anything that can be initialized without grid information can be initialized here.
    * Like universal constants, shoc options.
    */
+  const auto precision = m_params.get<std::string>("precision","double");
+  EKAT_REQUIRE_MSG (precision=="double" || precision=="single",
+      "Error! Invalid value for SHOC parameter 'precision'.\n"
+      " - precision: " + precision + "\n"
+      " - valid values: double, single\n");
+#ifndef SCREAM_SHOC_HAS_FLOAT
+  EKAT_REQUIRE_MSG (precision=="double",
+      "Error! SHOC single precision is not available in this build.\n"
+      "  It requires EAMXX_ENABLE_MIXED_PRECISION_PHYSICS=ON and SHOC small kernels OFF.\n");
+#endif
 }
 
 // =========================================================================================
@@ -244,6 +254,16 @@ void SHOCMacrophysics::init_buffers(const ATMBufferManager &buffer_manager)
   EKAT_REQUIRE_MSG(used_mem==requested_buffer_size_in_bytes(), "Error! Used memory != requested memory for SHOCMacrophysics.");
 }
 
+// =========================================================================================
+void SHOCMacrophysics::init_turbulence_state ()
+{
+  Kokkos::deep_copy(get_field_out("sgs_buoy_flux").get_view<Spack**>(),0.0);
+  Kokkos::deep_copy(get_field_out("eddy_diff_mom").get_view<Spack**>(),0.0);
+  Kokkos::deep_copy(get_field_out("tke").get_view<Spack**>(),0.0004);
+  Kokkos::deep_copy(m_buffer.tke_copy,0.0004);
+  Kokkos::deep_copy(get_field_out("cldfrac_liq").get_view<Spack**>(),0.0);
+}
+
 // =========================================================================================
 void SHOCMacrophysics::initialize_impl (const RunType run_type)
 {
@@ -312,11 +332,7 @@ void SHOCMacrophysics::initialize_impl (const RunType run_type)
 
   // Some SHOC variables should be initialized uniformly if an Initial run
   if (run_type==RunType::Initial){
-    Kokkos::deep_copy(sgs_buoy_flux,0.0);
-    Kokkos::deep_copy(tk,0.0);
-    Kokkos::deep_copy(tke,0.0004);
-    Kokkos::deep_copy(tke_copy,0.0004);
-    Kokkos::deep_copy(cldfrac_liq,0.0);
+    init_turbulence_state();
   }
 
   shoc_preprocess.set_variables(m_num_cols,m_num_levs,z_surf,
@@ -475,6 +491,14 @@ void SHOCMacrophysics::initialize_impl (const RunType run_type)
   }
   input.dx = cell_length;
   input.dy = cell_length;
+
+#ifdef SCREAM_SHOC_HAS_FLOAT
+  if (m_params.get<std::string>("precision","double")=="single") {
+    m_single_precision = std::make_shared<shoc::SHOCSinglePrecision>(
+        m_num_cols, m_num_levs, m_num_tracers, runtime_options,
+        input, input_output, output, history_output);
+  }
+#endif
 }
 
 // =========================================================================================
@@ -516,6 +540,11 @@ void SHOCMacrophysics::run_impl (const double dt)
   workspace_mgr.reset_internals();
 
   // Run shoc main
+#ifdef SCREAM_SHOC_HAS_FLOAT
+  if (m_single_precision) {
+    m_single_precision->run(m_npbl, m_nadv, dt);
+  } else
+#endif
   SHF::shoc_main(m_num_cols, m_num_levs, m_num_levs+1, m_npbl, m_nadv, m_num_tracers, dt,
                  workspace_mgr,runtime_options,input,input_output,output,history_output
 #ifdef SCREAM_SHOC_SMALL_KERNELS
@@ -4,6 +4,7 @@
 #include "share/atm_process/atmosphere_process.hpp"
 #include "ekat/ekat_parameter_list.hpp"
 #include "physics/shoc/shoc_functions.hpp"
+#include "physics/shoc/shoc_single_precision.hpp"
 #include "share/util/eamxx_common_physics_functions.hpp"
 #include "share/atm_process/ATMBufferManager.hpp"
 
@@ -463,6 +464,9 @@ protected:
 
   void initialize_impl (const RunType run_type);
 
+  // Set the SHOC state that is not read from the initial conditions
+  void init_turbulence_state ();
+
   // Update flux (if necessary)
   void check_flux_state_consistency(const double dt);
 
@@ -473,6 +477,7 @@ protected:
 
   void run_impl        (const double dt);
   void finalize_impl   ();
+  void reset_state_impl () { init_turbulence_state(); }
 
   // SHOC updates the 'tracers' group.
   void set_computed_group_impl (const FieldGroup& group);
@@ -513,6 +518,11 @@ protected:
   // WSM for internal local variables
   ekat::WorkspaceManager<Spack, KT::Device> workspace_mgr;
 
+#ifdef SCREAM_SHOC_HAS_FLOAT
+  // If precision=single, runs shoc_main in float on the views above
+  std::shared_ptr<shoc::SHOCSinglePrecision> m_single_precision;
+#endif
+
   std::shared_ptr<const AbstractGrid>   m_grid;
 }; // class SHOCMacrophysics
 
@@ -8,6 +8,9 @@ namespace shoc {
  */
 
 template struct Functions<Real,DefaultDevice>;
+#ifdef SCREAM_SHOC_HAS_FLOAT
+template struct Functions<float,DefaultDevice>;
+#endif
 
 } // namespace shoc
 } // namespace scream
@@ -17,7 +17,7 @@ void Functions<S,D>
 ::adv_sgs_tke(
   const MemberType&            team,
   const Int&                   nlev,
-  const Real&                  dtime,
+  const Scalar&                dtime,
   const bool&                  shoc_1p5tke,
   const uview_1d<const Spack>& shoc_mix,
   const uview_1d<const Spack>& wthv_sec,
@@ -31,8 +31,8 @@ void Functions<S,D>
   //Shared constants
   static constexpr Scalar ggr      = C::gravit;
   static constexpr Scalar basetemp = C::basetemp;
-  static constexpr Scalar mintke   = scream::shoc::Constants<Real>::mintke;
-  static constexpr Scalar maxtke   = scream::shoc::Constants<Real>::maxtke;
+  static constexpr Scalar mintke   = SC::mintke;
+  static constexpr Scalar maxtke   = SC::maxtke;
   Spack a_prod_bu;
 
   //declare some constants
@@ -15,7 +15,7 @@ void Functions<S,D>::check_length_scale_shoc_length(
   const Scalar&          dy,
   const uview_1d<Spack>& shoc_mix)
 {
-  const auto minlen = scream::shoc::Constants<Real>::minlen;
+  const auto minlen = SC::minlen;
 
   const Int nlev_pack = ekat::npack<Spack>(nlev);
   Kokkos::parallel_for(Kokkos::TeamVectorRange(team, nlev_pack), [&] (const Int& k) {
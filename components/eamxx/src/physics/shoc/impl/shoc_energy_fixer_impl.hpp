@@ -25,14 +25,14 @@ void Functions<S,D>::shoc_energy_fixer(
   const Int&                   nadv,
   const uview_1d<const Spack>& zt_grid,
   const uview_1d<const Spack>& zi_grid,
-  const Scalar&                se_b,
-  const Scalar&                ke_b,
-  const Scalar&                wv_b,
-  const Scalar&                wl_b,
-  const Scalar&                se_a,
-  const Scalar&                ke_a,
-  const Scalar&                wv_a,
-  const Scalar&                wl_a,
+  const Accum&                 se_b,
+  const Accum&                 ke_b,
+  const Accum&                 wv_b,
+  const Accum&                 wl_b,
+  const Accum&                 se_a,
+  const Accum&                 ke_a,
+  const Accum&                 wv_a,
+  const Accum&                 wl_a,
   const Scalar&                wthl_sfc,
   const Scalar&                wqw_sfc,
   const uview_1d<const Spack>& rho_zt,
@@ -51,9 +51,10 @@ void Functions<S,D>::shoc_energy_fixer(
   const auto mintke = SC::mintke;
   const auto ggr = C::gravit;
 
-  // Local variables
-  Scalar te_a = 0;
-  Scalar te_b = 0;
+  // Local variables. The energy budget is done in Accum, since the
+  // disbalance is a small difference of two large integrals.
+  Accum te_a = 0;
+  Accum te_b = 0;
   Scalar se_dis = 0;
 
   // Compute linear interpolation of data into rho_zi
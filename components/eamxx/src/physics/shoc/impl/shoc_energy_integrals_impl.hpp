@@ -18,10 +18,10 @@ void Functions<S,D>
   const uview_1d<const Spack>& rcm,
   const uview_1d<const Spack>& u_wind,
   const uview_1d<const Spack>& v_wind,
-  Scalar&                      se_int,
-  Scalar&                      ke_int,
-  Scalar&                      wv_int,
-  Scalar&                      wl_int)
+  Accum&                       se_int,
+  Accum&                       ke_int,
+  Accum&                       wv_int,
+  Accum&                       wl_int)
 {
   using ExeSpaceUtils = ekat::ExeSpaceUtils<typename KT::ExeSpace>;
   const auto ggr = C::gravit;
@@ -38,30 +38,46 @@ void Functions<S,D>
   // the view_reduction wrapper is not the cause by simplifying these to be bare
   // Kokkos::parallel_reduce calls acting on doubles and saw the same results.
 
+  // With reduced precision packs, the integrals are accumulated in Accum, one
+  // entry at a time, since the energy fixer uses the (small) difference of
+  // integrals computed before and after SHOC. Otherwise, use view_reduction,
+  // which is BFB with the fortran implementation.
+  const auto integrate = [&] (const auto& f) -> Accum {
+    if constexpr (std::is_same<Accum,Scalar>::value) {
+      return ExeSpaceUtils::view_reduction(team,0,nlev,f);
+    } else {
+      Accum result = 0;
+      Kokkos::parallel_reduce(Kokkos::TeamVectorRange(team,ekat::npack<Spack>(nlev)),
+                              [&] (const int k, Accum& lsum) {
+        const Spack val = f(k);
+        for (int s=0; s<Spack::n && k*Spack::n+s<nlev; ++s) {
+          lsum += val[s];
+        }
+      }, result);
+      return result;
+    }
+  };
+
   // Compute se_int
-  se_int = ExeSpaceUtils::view_reduction(team,0,nlev,
-                                [&] (const int k) -> Spack {
+  se_int = integrate([&] (const int k) -> Spack {
     return host_dse(k)*pdel(k)/ggr;
   });
   team.team_barrier();
 
   // Compute ke_int
-  ke_int = ExeSpaceUtils::view_reduction(team,0,nlev,
-                                [&] (const int k) -> Spack {
+  ke_int = integrate([&] (const int k) -> Spack {
     return sp(0.5)*(ekat::square(u_wind(k))+ekat::square(v_wind(k)))*pdel(k)/ggr;
   });
   team.team_barrier();
 
   // Compute wv_int
-  wv_int = ExeSpaceUtils::view_reduction(team,0,nlev,
-                                [&] (const int k) -> Spack {
+  wv_int = integrate([&] (const int k) -> Spack {
     return (rtm(k)-rcm(k))*pdel(k)/ggr;
   });
   team.team_barrier();
 
   // Compute wl_int
-  wl_int = ExeSpaceUtils::view_reduction(team,0,nlev,
-                                [&] (const int k) -> Spack {
+  wl_int = integrate([&] (const int k) -> Spack {
     return rcm(k)*pdel(k)/ggr;
   });
   team.team_barrier();
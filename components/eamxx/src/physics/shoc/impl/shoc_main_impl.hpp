@@ -150,9 +150,9 @@ void Functions<S,D>::shoc_main_internal(
     {&rho_zt, &shoc_qv, &shoc_tabs, &dz_zt, &dz_zi});
 
   // Local scalars
-  Scalar se_b{0},   ke_b{0},   wv_b{0}, wl_b{0},
-         se_a{0},   ke_a{0},   wv_a{0}, wl_a{0},
-         kbfs{0},   ustar2{0}, wstar{0};
+  Accum  se_b{0},   ke_b{0},   wv_b{0}, wl_b{0},
+         se_a{0},   ke_a{0},   wv_a{0}, wl_a{0};
+  Scalar kbfs{0},   ustar2{0}, wstar{0};
 
   // Scalarize some views for single entry access
   const auto s_thetal  = ekat::scalarize(thetal);
@@ -404,14 +404,14 @@ void Functions<S,D>::shoc_main_internal(
   const view_2d<Spack>&       brunt,
   const view_2d<Spack>&       isotropy,
   // Temporaries
-  const view_1d<Scalar>& se_b,
-  const view_1d<Scalar>& ke_b,
-  const view_1d<Scalar>& wv_b,
-  const view_1d<Scalar>& wl_b,
-  const view_1d<Scalar>& se_a,
-  const view_1d<Scalar>& ke_a,
-  const view_1d<Scalar>& wv_a,
-  const view_1d<Scalar>& wl_a,
+  const view_1d<Accum>& se_b,
+  const view_1d<Accum>& ke_b,
+  const view_1d<Accum>& wv_b,
+  const view_1d<Accum>& wl_b,
+  const view_1d<Accum>& se_a,
+  const view_1d<Accum>& ke_a,
+  const view_1d<Accum>& wv_a,
+  const view_1d<Accum>& wl_a,
   const view_1d<Scalar>& kbfs,
   const view_1d<Scalar>& ustar2,
   const view_1d<Scalar>& wstar,
@@ -426,39 +426,53 @@ void Functions<S,D>::shoc_main_internal(
   const auto s_shoc_ql = ekat::scalarize(shoc_ql);
   const auto s_shoc_qv = ekat::scalarize(shoc_qv);
 
+  // Each sub-step is wrapped in a profiling region, so that Kokkos tools
+  // (and shoc_sk_bench) can time them separately. Regions are no-ops otherwise.
+
   // Compute integrals of static energy, kinetic energy, water vapor, and liquid water
   // for the computation of total energy before SHOC is called.  This is for an
   // effort to conserve energy since liquid water potential temperature (which SHOC
   // conserves) and static energy (which E3SM conserves) are not exactly equal.
+  Kokkos::Profiling::pushRegion("shoc::shoc_energy_integrals");
   shoc_energy_integrals_disp(shcol,nlev,host_dse,pdel,qw,shoc_ql,u_wind,v_wind,
                              se_b, ke_b, wv_b, wl_b); // Input
+  Kokkos::Profiling::popRegion();
 
   for (Int t=0; t<nadv; ++t) {
     // Check TKE to make sure values lie within acceptable
     // bounds after host model performs horizontal advection
+    Kokkos::Profiling::pushRegion("shoc::check_tke");
     check_tke_disp(shcol,nlev, // Input
                    tke);      // Input/Output
+    Kokkos::Profiling::popRegion();
 
     // Define vertical grid arrays needed for
     // vertical derivatives in SHOC, also
     // define air density (rho_zt)
+    Kokkos::Profiling::pushRegion("shoc::shoc_grid");
     shoc_grid_disp(shcol,nlev,nlevi,      // Input
                    zt_grid,zi_grid,pdel, // Input
                    dz_zt,dz_zi,rho_zt);  // Output
+    Kokkos::Profiling::popRegion();
 
     // Compute the planetary boundary layer height, which is an
     // input needed for the length scale calculation.
 
     // Update SHOC water vapor,
     // to be used by the next two routines
+    Kokkos::Profiling::pushRegion("shoc::compute_shoc_vapor");
     compute_shoc_vapor_disp(shcol,nlev,qw,shoc_ql, // Input
                             shoc_qv);             // Output
+    Kokkos::Profiling::popRegion();
 
     // Update SHOC temperature
+    Kokkos::Profiling::pushRegion("shoc::compute_shoc_temperature");
     compute_shoc_temperature_disp(shcol,nlev,thetal,  // Input
                                   shoc_ql,inv_exner, // Input
                                   shoc_tabs);        // Output
+    Kokkos::Profiling::popRegion();
 
+    Kokkos::Profiling::pushRegion("shoc::shoc_diag_obklen");
     shoc_diag_obklen_disp(shcol, nlev,
                           uw_sfc,vw_sfc,     // Input
                           wthl_sfc, wqw_sfc, // Input
@@ -466,7 +480,9 @@ void Functions<S,D>::shoc_main_internal(
                           s_shoc_ql, // Input
                           s_shoc_qv, // Input
                           ustar,kbfs,obklen); // Output
+    Kokkos::Profiling::popRegion();
 
+    Kokkos::Profiling::pushRegion("shoc::pblintd");
     pblintd_disp(shcol,nlev,nlevi,npbl,    // Input
                  zt_grid,zi_grid,thetal,   // Input
                  shoc_ql,shoc_qv,u_wind,   // Input
@@ -474,8 +490,10 @@ void Functions<S,D>::shoc_main_internal(
                  shoc_cldfrac,             // Input
                  workspace_mgr,            // Workspace mgr
                  pblh);                    // Output
+    Kokkos::Profiling::popRegion();
 
     // Update the turbulent length scale
+    Kokkos::Profiling::pushRegion("shoc::shoc_length");
     shoc_length_disp(shcol,nlev,nlevi,      // Input
                      length_fac,shoc_1p5tke,// Runtime Options
                      dx,dy,                 // Input
@@ -483,8 +501,10 @@ void Functions<S,D>::shoc_main_internal(
                      tke,thv,tk,            // Input
                      workspace_mgr,         // Workspace mgr
                      brunt,shoc_mix);       // Output
+    Kokkos::Profiling::popRegion();
 
     // Advance the SGS TKE equation
+    Kokkos::Profiling::pushRegion("shoc::shoc_tke");
     shoc_tke_disp(shcol,nlev,nlevi,dtime,               // Input
 	          lambda_low,lambda_high,lambda_slope,  // Runtime options
 		  lambda_thresh,Ckh,Ckm,shoc_1p5tke,    // Runtime options
@@ -495,16 +515,20 @@ void Functions<S,D>::shoc_main_internal(
                   workspace_mgr,                        // Workspace mgr
                   tke,tk,tkh,                           // Input/Output
                   isotropy);                            // Output
+    Kokkos::Profiling::popRegion();
 
     // Update SHOC prognostic variables here
     // via implicit diffusion solver
+    Kokkos::Profiling::pushRegion("shoc::update_prognostics_implicit");
     update_prognostics_implicit_disp(shcol,nlev,nlevi,num_qtracers,dtime,dz_zt,  // Input
                                      dz_zi,rho_zt,zt_grid,zi_grid,tk,tkh,uw_sfc, // Input
                                      vw_sfc,wthl_sfc,wqw_sfc,wtracer_sfc,        // Input
                                      workspace_mgr,                              // Workspace mgr
                                      thetal,qw,qtracers,tke,u_wind,v_wind);      // Input/Output
+    Kokkos::Profiling::popRegion();
 
     // Diagnose the second order moments
+    Kokkos::Profiling::pushRegion("shoc::diag_second_shoc_moments");
     diag_second_shoc_moments_disp(shcol,nlev,nlevi,
                                   thl2tune, qw2tune, qwthl2tune, w2tune,     // Runtime options
 				  shoc_1p5tke,                               // Runtime options
@@ -515,9 +539,11 @@ void Functions<S,D>::shoc_main_internal(
                                   workspace_mgr,                             // Workspace
                                   thl_sec,qw_sec,wthl_sec,wqw_sec,qwthl_sec, // Output
                                   uw_sec,vw_sec,wtke_sec,w_sec);             // Output
+    Kokkos::Profiling::popRegion();
 
     // Diagnose the third moment of vertical velocity,
     //  needed for the PDF closure
+    Kokkos::Profiling::pushRegion("shoc::diag_third_shoc_moments");
     diag_third_shoc_moments_disp(shcol,nlev,nlevi,
                                  c_diag_3rd_mom,shoc_1p5tke,             // Runtime options
                                  w_sec,thl_sec,wthl_sec,                 // Input
@@ -525,8 +551,10 @@ void Functions<S,D>::shoc_main_internal(
                                  zt_grid,zi_grid,                        // Input
                                  workspace_mgr,                          // Workspace mgr
                                  w3);                                    // Output
+    Kokkos::Profiling::popRegion();
 
     // Call the PDF to close on SGS cloud and turbulence
+    Kokkos::Profiling::pushRegion("shoc::shoc_assumed_pdf");
     shoc_assumed_pdf_disp(shcol,nlev,nlevi,thetal,qw,w_field,thl_sec,qw_sec, // Input
                           dtime,extra_diags,                                // Runtime options
                           wthl_sec,w_sec,wqw_sec,qwthl_sec,w3,pres,         // Input
@@ -534,29 +562,38 @@ void Functions<S,D>::shoc_main_internal(
                           workspace_mgr,                                    // Workspace mgr
                           shoc_cond,shoc_evap,                              // Output
                           shoc_cldfrac,shoc_ql,wqls_sec,wthv_sec,shoc_ql2); // Ouptut
+    Kokkos::Profiling::popRegion();
 
     // Check TKE to make sure values lie within acceptable
     // bounds after vertical advection, etc.
+    Kokkos::Profiling::pushRegion("shoc::check_tke");
     check_tke_disp(shcol,nlev,tke);
+    Kokkos::Profiling::popRegion();
   }
 
   // End SHOC parameterization
 
   // Use SHOC outputs to update the host model
   // temperature
+  Kokkos::Profiling::pushRegion("shoc::update_host_dse");
   update_host_dse_disp(shcol,nlev,thetal,shoc_ql, // Input
                        inv_exner,zt_grid,phis,   // Input
                        host_dse);                // Output
+  Kokkos::Profiling::popRegion();
 
+  Kokkos::Profiling::pushRegion("shoc::shoc_energy_integrals");
   shoc_energy_integrals_disp(shcol,nlev,host_dse,pdel,  // Input
                         qw,shoc_ql,u_wind,v_wind, // Input
                         se_a,ke_a,wv_a,wl_a);     // Output
+  Kokkos::Profiling::popRegion();
 
+  Kokkos::Profiling::pushRegion("shoc::shoc_energy_fixer");
   shoc_energy_fixer_disp(shcol,nlev,nlevi,dtime,nadv,zt_grid,zi_grid, // Input
                          se_b,ke_b,wv_b,wl_b,se_a,ke_a,wv_a,wl_a,    // Input
                          wthl_sfc,wqw_sfc,rho_zt,tke,presi,          // Input
                          workspace_mgr,                              // Workspace
                          host_dse);                                  // Output
+  Kokkos::Profiling::popRegion();
 
   // Remaining code is to diagnose certain quantities
   // related to PBL.  No answer changing subroutines
@@ -566,22 +603,28 @@ void Functions<S,D>::shoc_main_internal(
   // may require this variable.
 
   // Update SHOC water vapor, to be used by the next two routines
+  Kokkos::Profiling::pushRegion("shoc::compute_shoc_vapor");
   compute_shoc_vapor_disp(shcol,nlev,qw,shoc_ql, // Input
                           shoc_qv);             // Output
+  Kokkos::Profiling::popRegion();
 
+  Kokkos::Profiling::pushRegion("shoc::shoc_diag_obklen");
   shoc_diag_obklen_disp(shcol, nlev, uw_sfc,vw_sfc,      // Input
                         wthl_sfc,wqw_sfc,   // Input
                         s_thetal,   // Input
                         s_shoc_ql,  // Input
                         s_shoc_qv,  // Input
                         ustar,kbfs,obklen); // Output
+  Kokkos::Profiling::popRegion();
 
+  Kokkos::Profiling::pushRegion("shoc::pblintd");
   pblintd_disp(shcol,nlev,nlevi,npbl,zt_grid,   // Input
                zi_grid,thetal,shoc_ql,shoc_qv, // Input
                u_wind,v_wind,ustar,obklen,     // Input
                kbfs,shoc_cldfrac,              // Input
                workspace_mgr,                  // Workspace mgr
                pblh);                          // Output
+  Kokkos::Profiling::popRegion();
 }
 #endif
 
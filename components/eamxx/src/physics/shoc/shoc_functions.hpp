@@ -9,6 +9,13 @@
 #include "ekat/ekat_pack_kokkos.hpp"
 #include "ekat/ekat_workspace.hpp"
 
+// A single precision version of SHOC is available in mixed precision builds.
+// The small kernels dispatch routines (disp/*.cpp) only exist for Real,
+// so the float version is limited to the monolithic kernel.
+#if defined(EAMXX_ENABLE_MIXED_PRECISION_PHYSICS) && !defined(SCREAM_SHOC_SMALL_KERNELS)
+# define SCREAM_SHOC_HAS_FLOAT
+#endif
+
 namespace scream {
 namespace shoc {
 
@@ -31,10 +38,12 @@ struct Functions
   using Scalar = ScalarT;
   using Device = DeviceT;
 
+  // Pack sizes are set by the Scalar type, so that reduced precision packs are
+  // wider (see pack_size_for), while all packs used together have the same size.
   template <typename S>
-  using BigPack = ekat::Pack<S,SCREAM_PACK_SIZE>;
+  using BigPack = ekat::Pack<S,pack_size_for<Scalar,SCREAM_PACK_SIZE>()>;
   template <typename S>
-  using SmallPack = ekat::Pack<S,SCREAM_SMALL_PACK_SIZE>;
+  using SmallPack = ekat::Pack<S,pack_size_for<Scalar,SCREAM_SMALL_PACK_SIZE>()>;
 
   using IntSmallPack = SmallPack<Int>;
   using Pack = BigPack<Scalar>;
@@ -43,6 +52,10 @@ struct Functions
   using Mask  = ekat::Mask<Pack::n>;
   using Smask = ekat::Mask<Spack::n>;
 
+  // Type used for sensitive accumulations (e.g., the column energy integrals):
+  // these are never done at a lower precision than Real.
+  using Accum = typename std::conditional<(sizeof(Scalar)<sizeof(Real)),Real,Scalar>::type;
+
   using KT = ekat::KokkosTypes<Device>;
 
   using C  = physics::Constants<Scalar>;
@@ -221,14 +234,14 @@ struct Functions
   struct SHOCTemporaries {
     SHOCTemporaries() = default;
 
-    view_1d<Scalar> se_b;
-    view_1d<Scalar> ke_b;
-    view_1d<Scalar> wv_b;
-    view_1d<Scalar> wl_b;
-    view_1d<Scalar> se_a;
-    view_1d<Scalar> ke_a;
-    view_1d<Scalar> wv_a;
-    view_1d<Scalar> wl_a;
+    view_1d<Accum> se_b;
+    view_1d<Accum> ke_b;
+    view_1d<Accum> wv_b;
+    view_1d<Accum> wl_b;
+    view_1d<Accum> se_a;
+    view_1d<Accum> ke_a;
+    view_1d<Accum> wv_a;
+    view_1d<Accum> wl_a;
     view_1d<Scalar> kbfs;
     view_1d<Scalar> ustar2;
     view_1d<Scalar> wstar;
@@ -377,10 +390,10 @@ struct Functions
     const uview_1d<const Spack>& rcm,
     const uview_1d<const Spack>& u_wind,
     const uview_1d<const Spack>& v_wind,
-    Scalar&                      se_int,
-    Scalar&                      ke_int,
-    Scalar&                      wv_int,
-    Scalar&                      wl_int);
+    Accum&                       se_int,
+    Accum&                       ke_int,
+    Accum&                       wv_int,
+    Accum&                       wl_int);
 #ifdef SCREAM_SHOC_SMALL_KERNELS
   static void shoc_energy_integrals_disp(
     const Int&                   shcol,
@@ -391,10 +404,10 @@ struct Functions
     const view_2d<const Spack>& rcm,
     const uview_2d<const Spack>& u_wind,
     const uview_2d<const Spack>& v_wind,
-    const view_1d<Scalar>& se_b_slot,
-    const view_1d<Scalar>& ke_b_slot,
-    const view_1d<Scalar>& wv_b_slot,
-    const view_1d<Scalar>& wl_b_slot);
+    const view_1d<Accum>& se_b_slot,
+    const view_1d<Accum>& ke_b_slot,
+    const view_1d<Accum>& wv_b_slot,
+    const view_1d<Accum>& wl_b_slot);
 #endif
 
   KOKKOS_FUNCTION
@@ -406,7 +419,7 @@ struct Functions
 
   KOKKOS_FUNCTION
   static void diag_second_moments(const MemberType& team, const Int& nlev, const Int& nlevi,
-     const Real& thl2tune, const Real& qw2tune, const Real& qwthl2tune, const Real& w2tune, const bool& shoc_1p5tke,
+     const Scalar& thl2tune, const Scalar& qw2tune, const Scalar& qwthl2tune, const Scalar& w2tune, const bool& shoc_1p5tke,
      const uview_1d<const Spack>& thetal, const uview_1d<const Spack>& qw, const uview_1d<const Spack>& u_wind,
      const uview_1d<const Spack>& v_wind, const uview_1d<const Spack>& tke, const uview_1d<const Spack>& isotropy,
      const uview_1d<const Spack>& tkh, const uview_1d<const Spack>& tk, const uview_1d<const Spack>& dz_zi,
@@ -572,14 +585,14 @@ struct Functions
     const Int&                   nadv,
     const uview_1d<const Spack>& zt_grid,
     const uview_1d<const Spack>& zi_grid,
-    const Scalar&                se_b,
-    const Scalar&                ke_b,
-    const Scalar&                wv_b,
-    const Scalar&                wl_b,
-    const Scalar&                se_a,
-    const Scalar&                ke_a,
-    const Scalar&                wv_a,
-    const Scalar&                wl_a,
+    const Accum&                 se_b,
+    const Accum&                 ke_b,
+    const Accum&                 wv_b,
+    const Accum&                 wl_b,
+    const Accum&                 se_a,
+    const Accum&                 ke_a,
+    const Accum&                 wv_a,
+    const Accum&                 wl_a,
     const Scalar&                wthl_sfc,
     const Scalar&                wqw_sfc,
     const uview_1d<const Spack>& rho_zt,
@@ -596,14 +609,14 @@ struct Functions
     const Int&                   nadv,
     const view_2d<const Spack>&  zt_grid,
     const view_2d<const Spack>&  zi_grid,
-    const view_1d<const Scalar>& se_b,
-    const view_1d<const Scalar>& ke_b,
-    const view_1d<const Scalar>& wv_b,
-    const view_1d<const Scalar>& wl_b,
-    const view_1d<const Scalar>& se_a,
-    const view_1d<const Scalar>& ke_a,
-    const view_1d<const Scalar>& wv_a,
-    const view_1d<const Scalar>& wl_a,
+    const view_1d<const Accum>& se_b,
+    const view_1d<const Accum>& ke_b,
+    const view_1d<const Accum>& wv_b,
+    const view_1d<const Accum>& wl_b,
+    const view_1d<const Accum>& se_a,
+    const view_1d<const Accum>& ke_a,
+    const view_1d<const Accum>& wv_a,
+    const view_1d<const Accum>& wl_a,
     const view_1d<const Scalar>& wthl_sfc,
     const view_1d<const Scalar>& wqw_sfc,
     const view_2d<const Spack>&  rho_zt,
@@ -747,7 +760,7 @@ struct Functions
   static void adv_sgs_tke(
     const MemberType&            team,
     const Int&                   nlev,
-    const Real&                  dtime,
+    const Scalar&                dtime,
     const bool&                  shoc_1p5tke,
     const uview_1d<const Spack>& shoc_mix,
     const uview_1d<const Spack>& wthv_sec,
@@ -1176,14 +1189,14 @@ struct Functions
     const view_2d<Spack>&       brunt,
     const view_2d<Spack>&       isotropy,
     // Temporaries
-    const view_1d<Scalar>& se_b,
-    const view_1d<Scalar>& ke_b,
-    const view_1d<Scalar>& wv_b,
-    const view_1d<Scalar>& wl_b,
-    const view_1d<Scalar>& se_a,
-    const view_1d<Scalar>& ke_a,
-    const view_1d<Scalar>& wv_a,
-    const view_1d<Scalar>& wl_a,
+    const view_1d<Accum>& se_b,
+    const view_1d<Accum>& ke_b,
+    const view_1d<Accum>& wv_b,
+    const view_1d<Accum>& wl_b,
+    const view_1d<Accum>& se_a,
+    const view_1d<Accum>& ke_a,
+    const view_1d<Accum>& wv_a,
+    const view_1d<Accum>& wl_a,
     const view_1d<Scalar>& kbfs,
     const view_1d<Scalar>& ustar2,
     const view_1d<Scalar>& wstar,
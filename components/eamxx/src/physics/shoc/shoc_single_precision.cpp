@@ -0,0 +1,224 @@
+#include "physics/shoc/shoc_single_precision.hpp"
+
+#include <ekat/kokkos/ekat_kokkos_utils.hpp>
+
+namespace scream {
+namespace shoc {
+
+#ifdef SCREAM_SHOC_HAS_FLOAT
+
+namespace {
+
+using SHFF = SHOCSinglePrecision::SHFF;
+using ExeSpace = SHFF::KT::ExeSpace;
+
+// Allocate the float counterpart of a shoc_main view. Rank-1 views hold
+// scalars, while in rank-2/3 views the last extent is over packs.
+template<typename DV>
+auto make_float_view (const std::string& name, const DV& d)
+{
+  using DP = typename DV::non_const_value_type;
+  using FP = SHFF::Spack;
+  constexpr int rank = DV::rank;
+  if constexpr (rank==1) {
+    return SHFF::view_1d<float>(name,d.extent(0));
+  } else if constexpr (rank==2) {
+    return SHFF::view_2d<FP>(name,d.extent(0),ekat::npack<FP>(d.extent(1)*DP::n));
+  } else {
+    static_assert(rank==3, "Error! Unexpected view rank in SHOC single precision.\n");
+    return SHFF::view_3d<FP>(name,d.extent(0),d.extent(1),ekat::npack<FP>(d.extent(2)*DP::n));
+  }
+}
+
+// Copy src into dst, converting the scalar type (and hence the pack size).
+// The number of scalars along the packed extent is taken from src, so
+// padding entries of the wider float packs are never copied back.
+template<typename DstView, typename SrcView>
+void repack (const DstView& dst, const SrcView& src, const int nscalars)
+{
+  using DP = typename DstView::non_const_value_type;
+  using SP = typename SrcView::non_const_value_type;
+  constexpr int rank = DstView::rank;
+  if constexpr (rank==1) {
+    using S = DP;
+    Kokkos::parallel_for(Kokkos::RangePolicy<ExeSpace>(0,dst.extent(0)),
+                         KOKKOS_LAMBDA (const int i) {
+      dst(i) = static_cast<S>(src(i));
+    });
+  } else if constexpr (rank==2) {
+    using S = typename DP::scalar;
+    using policy_t = Kokkos::MDRangePolicy<ExeSpace,Kokkos::Rank<2>>;
+    const int n0 = dst.extent(0);
+    Kokkos::parallel_for(policy_t({0,0},{n0,nscalars}),
+                         KOKKOS_LAMBDA (const int i, const int k) {
+      dst(i,k/DP::n)[k%DP::n] = static_cast<S>(src(i,k/SP::n)[k%SP::n]);
+    });
+  } else {
+    using S = typename DP::scalar;
+    using policy_t = Kokkos::MDRangePolicy<ExeSpace,Kokkos::Rank<3>>;
+    const int n0 = dst.extent(0);
+    const int n1 = dst.extent(1);
+    Kokkos::parallel_for(policy_t({0,0,0},{n0,n1,nscalars}),
+                         KOKKOS_LAMBDA (const int i, const int j, const int k) {
+      dst(i,j,k/DP::n)[k%DP::n] = static_cast<S>(src(i,j,k/SP::n)[k%SP::n]);
+    });
+  }
+}
+
+template<typename DV>
+int num_scalars (const DV& d)
+{
+  using DP = typename DV::non_const_value_type;
+  constexpr int rank = DV::rank;
+  if constexpr (rank==1) {
+    return d.extent(0);
+  } else {
+    return d.extent(rank-1)*DP::n;
+  }
+}
+
+} // anonymous namespace
+
+template<typename FV, typename DV>
+void SHOCSinglePrecision::
+bind_in (FV& f, const DV& d, const std::string& name)
+{
+  const auto fv = make_float_view(name,d);
+  const int n = num_scalars(d);
+  f = fv;
+  m_copy_in.push_back([=]() { repack(fv,d,n); });
+}
+
+template<typename FV, typename DV>
+void SHOCSinglePrecision::
+bind_out (FV& f, const DV& d, const std::string& name, const bool copy_in)
+{
+  const auto fv = make_float_view(name,d);
+  const int n = num_scalars(d);
+  f = fv;
+  if (copy_in) {
+    m_copy_in.push_back([=]() { repack(fv,d,n); });
+  }
+  m_copy_out.push_back([=]() { repack(d,fv,n); });
+}
+
+SHOCSinglePrecision::
+SHOCSinglePrecision (const Int ncol, const Int nlev, const Int num_tracers,
+                     const SHF::SHOCRuntime&       runtime,
+                     const SHF::SHOCInput&         input,
+                     const SHF::SHOCInputOutput&   input_output,
+                     const SHF::SHOCOutput&        output,
+                     const SHF::SHOCHistoryOutput& history_output)
+ : m_ncol(ncol)
+ , m_nlev(nlev)
+ , m_num_tracers(num_tracers)
+{
+  m_runtime.lambda_low     = runtime.lambda_low;
+  m_runtime.lambda_high    = runtime.lambda_high;
+  m_runtime.lambda_slope   = runtime.lambda_slope;
+  m_runtime.lambda_thresh  = runtime.lambda_thresh;
+  m_runtime.thl2tune       = runtime.thl2tune;
+  m_runtime.qw2tune        = runtime.qw2tune;
+  m_runtime.qwthl2tune     = runtime.qwthl2tune;
+  m_runtime.w2tune         = runtime.w2tune;
+  m_runtime.length_fac     = runtime.length_fac;
+  m_runtime.c_diag_3rd_mom = runtime.c_diag_3rd_mom;
+  m_runtime.Ckh            = runtime.Ckh;
+  m_runtime.Ckm            = runtime.Ckm;
+  m_runtime.shoc_1p5tke    = runtime.shoc_1p5tke;
+  m_runtime.extra_diags    = runtime.extra_diags;
+
+  // Input
+  bind_in(m_input.dx,          input.dx,          "dx");
+  bind_in(m_input.dy,          input.dy,          "dy");
+  bind_in(m_input.zt_grid,     input.zt_grid,     "zt_grid");
+  bind_in(m_input.zi_grid,     input.zi_grid,     "zi_grid");
+  bind_in(m_input.pres,        input.pres,        "pres");
+  bind_in(m_input.presi,       input.presi,       "presi");
+  bind_in(m_input.pdel,        input.pdel,        "pdel");
+  bind_in(m_input.thv,         input.thv,         "thv");
+  bind_in(m_input.w_field,     input.w_field,     "w_field");
+  bind_in(m_input.wthl_sfc,    input.wthl_sfc,    "wthl_sfc");
+  bind_in(m_input.wqw_sfc,     input.wqw_sfc,     "wqw_sfc");
+  bind_in(m_input.uw_sfc,      input.uw_sfc,      "uw_sfc");
+  bind_in(m_input.vw_sfc,      input.vw_sfc,      "vw_sfc");
+  bind_in(m_input.wtracer_sfc, input.wtracer_sfc, "wtracer_sfc");
+  bind_in(m_input.inv_exner,   input.inv_exner,   "inv_exner");
+  bind_in(m_input.phis,        input.phis,        "phis");
+
+  // Input/Output
+  bind_out(m_input_output.host_dse,     input_output.host_dse,     "host_dse",     true);
+  bind_out(m_input_output.tke,          input_output.tke,          "tke",          true);
+  bind_out(m_input_output.thetal,       input_output.thetal,       "thetal",       true);
+  bind_out(m_input_output.qw,           input_output.qw,           "qw",           true);
+  bind_out(m_input_output.horiz_wind,   input_output.horiz_wind,   "horiz_wind",   true);
+  bind_out(m_input_output.wthv_sec,     input_output.wthv_sec,     "wthv_sec",     true);
+  bind_out(m_input_output.qtracers,     input_output.qtracers,     "qtracers",     true);
+  bind_out(m_input_output.tk,           input_output.tk,           "tk",           true);
+  bind_out(m_input_output.shoc_cldfrac, input_output.shoc_cldfrac, "shoc_cldfrac", true);
+  bind_out(m_input_output.shoc_ql,      input_output.shoc_ql,      "shoc_ql",      true);
+
+  // Output
+  bind_out(m_output.pblh,     output.pblh,     "pblh",     false);
+  bind_out(m_output.ustar,    output.ustar,    "ustar",    false);
+  bind_out(m_output.obklen,   output.obklen,   "obklen",   false);
+  bind_out(m_output.shoc_ql2, output.shoc_ql2, "shoc_ql2", false);
+  bind_out(m_output.tkh,      output.tkh,      "tkh",      false);
+
+  // Output (diagnostic)
+  bind_out(m_history_output.shoc_mix,  history_output.shoc_mix,  "shoc_mix",  false);
+  bind_out(m_history_output.w_sec,     history_output.w_sec,     "w_sec",     false);
+  bind_out(m_history_output.thl_sec,   history_output.thl_sec,   "thl_sec",   false);
+  bind_out(m_history_output.qw_sec,    history_output.qw_sec,    "qw_sec",    false);
+  bind_out(m_history_output.qwthl_sec, history_output.qwthl_sec, "qwthl_sec", false);
+  bind_out(m_history_output.wthl_sec,  history_output.wthl_sec,  "wthl_sec",  false);
+  bind_out(m_history_output.wqw_sec,   history_output.wqw_sec,   "wqw_sec",   false);
+  bind_out(m_history_output.wtke_sec,  history_output.wtke_sec,  "wtke_sec",  false);
+  bind_out(m_history_output.uw_sec,    history_output.uw_sec,    "uw_sec",    false);
+  bind_out(m_history_output.vw_sec,    history_output.vw_sec,    "vw_sec",    false);
+  bind_out(m_history_output.w3,        history_output.w3,        "w3",        false);
+  bind_out(m_history_output.wqls_sec,  history_output.wqls_sec,  "wqls_sec",  false);
+  bind_out(m_history_output.brunt,     history_output.brunt,     "brunt",     false);
+  bind_out(m_history_output.isotropy,  history_output.isotropy,  "isotropy",  false);
+  if (runtime.extra_diags) {
+    bind_out(m_history_output.shoc_cond, history_output.shoc_cond, "shoc_cond", false);
+    bind_out(m_history_output.shoc_evap, history_output.shoc_evap, "shoc_evap", false);
+  } else {
+    // Not output, so no need to copy them back
+    m_history_output.shoc_cond = make_float_view("shoc_cond",history_output.shoc_cond);
+    m_history_output.shoc_evap = make_float_view("shoc_evap",history_output.shoc_evap);
+  }
+
+  // WSM for the float shoc_main (same layout as in the SHOC process interface)
+  using FSpack = SHFF::Spack;
+  const int nlev_packs   = ekat::npack<FSpack>(m_nlev);
+  const int nlevi_packs  = ekat::npack<FSpack>(m_nlev+1);
+  const int n_wind_slots = ekat::npack<FSpack>(2)*FSpack::n;
+  const int n_trac_slots = ekat::npack<FSpack>(m_num_tracers+3)*FSpack::n;
+  const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(m_ncol, nlev_packs);
+  m_wsm = std::make_unique<SHFF::WorkspaceMgr>(nlevi_packs, 14+(n_wind_slots+n_trac_slots), policy);
+}
+
+Int SHOCSinglePrecision::run (const Int npbl, const Int nadv, const Real dtime)
+{
+  for (const auto& f : m_copy_in) {
+    f();
+  }
+
+  m_wsm->reset_internals();
+  const float dtime_f = dtime;
+  const auto elapsed = SHFF::shoc_main(m_ncol, m_nlev, m_nlev+1, npbl, nadv, m_num_tracers, dtime_f,
+                                       *m_wsm, m_runtime, m_input, m_input_output, m_output, m_history_output);
+
+  for (const auto& f : m_copy_out) {
+    f();
+  }
+  Kokkos::fence();
+
+  return elapsed;
+}
+
+#endif // SCREAM_SHOC_HAS_FLOAT
+
+} // namespace shoc
+} // namespace scream
@@ -0,0 +1,71 @@
+#ifndef SHOC_SINGLE_PRECISION_HPP
+#define SHOC_SINGLE_PRECISION_HPP
+
+#include "physics/shoc/shoc_functions.hpp"
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace scream {
+namespace shoc {
+
+#ifdef SCREAM_SHOC_HAS_FLOAT
+
+/*
+ * Runs shoc_main in single precision on the (double precision) views
+ * of a SHOC run.
+ *
+ * At construction, float copies of all the shoc_main views are allocated,
+ * with the (wider) float pack size. At each run, the inputs are converted
+ * to float, shoc_main runs on the float copies, and the results are
+ * converted back. The column energy integrals of the energy fixer are
+ * still accumulated in double (see Functions::Accum).
+ */
+
+class SHOCSinglePrecision
+{
+public:
+  using SHF  = Functions<Real,DefaultDevice>;
+  using SHFF = Functions<float,DefaultDevice>;
+
+  SHOCSinglePrecision (const Int ncol, const Int nlev, const Int num_tracers,
+                       const SHF::SHOCRuntime&       runtime,
+                       const SHF::SHOCInput&         input,
+                       const SHF::SHOCInputOutput&   input_output,
+                       const SHF::SHOCOutput&        output,
+                       const SHF::SHOCHistoryOutput& history_output);
+
+  // Same as SHF::shoc_main, with the views given at construction.
+  // Returns the elapsed time of the float shoc_main, in microseconds.
+  Int run (const Int npbl, const Int nadv, const Real dtime);
+
+private:
+  template<typename FV, typename DV>
+  void bind_in (FV& f, const DV& d, const std::string& name);
+  template<typename FV, typename DV>
+  void bind_out (FV& f, const DV& d, const std::string& name, const bool copy_in);
+
+  Int m_ncol;
+  Int m_nlev;
+  Int m_num_tracers;
+
+  SHFF::SHOCRuntime       m_runtime;
+  SHFF::SHOCInput         m_input;
+  SHFF::SHOCInputOutput   m_input_output;
+  SHFF::SHOCOutput        m_output;
+  SHFF::SHOCHistoryOutput m_history_output;
+
+  std::unique_ptr<SHFF::WorkspaceMgr> m_wsm;
+
+  // Conversions double->float (before shoc_main) and float->double (after)
+  std::vector<std::function<void()>> m_copy_in;
+  std::vector<std::function<void()>> m_copy_out;
+};
+
+#endif // SCREAM_SHOC_HAS_FLOAT
+
+} // namespace shoc
+} // namespace scream
+
+#endif // SHOC_SINGLE_PRECISION_HPP
@@ -12,7 +12,7 @@ using scream::Int;
 namespace scream {
 namespace shoc {
 
-Int shoc_main(FortranData& d) {
+Int shoc_main(FortranData& d, bool single_precision) {
   EKAT_REQUIRE_MSG(d.dtime > 0, "Invalid dtime");
   EKAT_REQUIRE_MSG(d.nadv > 0,  "Invalid nadv");
   const int npbl = d.nlev;
@@ -31,7 +31,7 @@ Int shoc_main(FortranData& d) {
                         d.qw_sec.data(), d.qwthl_sec.data(), d.wthl_sec.data(), d.wqw_sec.data(),
                         d.wtke_sec.data(), d.uw_sec.data(),
                         d.vw_sec.data(), d.w3.data(), d.wqls_sec.data(), d.brunt.data(),
-                        d.shoc_ql2.data());
+                        d.shoc_ql2.data(), single_precision);
 }
 
 namespace {
@@ -11,8 +11,9 @@ namespace shoc {
 
 struct FortranData;
 
-// Run SHOC subroutines, populating inout and out fields of d.
-ekat::Int shoc_main(FortranData& d);
+// Run SHOC subroutines, populating inout and out fields of d. If
+// single_precision is true, shoc_main runs in float (see SHOCSinglePrecision).
+ekat::Int shoc_main(FortranData& d, bool single_precision = false);
 
 // Test SHOC by running initial conditions for a number of steps and comparing
 // against reference data. If gen_plot_scripts is true, Python scripts are
@@ -1,6 +1,7 @@
 #include "shoc_test_data.hpp"
 
 #include "shoc_data.hpp"
+#include "physics/shoc/shoc_single_precision.hpp"
 
 #include "ekat/ekat_assert.hpp"
 #include "ekat/kokkos/ekat_kokkos_utils.hpp"
@@ -2230,8 +2231,13 @@ Int shoc_main_host(Int shcol, Int nlev, Int nlevi, Real dtime, Int nadv, Int npb
                 Real* thetal, Real* qw, Real* u_wind, Real* v_wind, Real* qtracers, Real* wthv_sec, Real* tkh, Real* tk,
                 Real* shoc_ql, Real* shoc_cldfrac, Real* pblh, Real* shoc_mix, Real* isotropy, Real* w_sec, Real* thl_sec,
                 Real* qw_sec, Real* qwthl_sec, Real* wthl_sec, Real* wqw_sec, Real* wtke_sec, Real* uw_sec, Real* vw_sec,
-                Real* w3, Real* wqls_sec, Real* brunt, Real* shoc_ql2)
+                Real* w3, Real* wqls_sec, Real* brunt, Real* shoc_ql2, bool single_precision)
 {
+#ifndef SCREAM_SHOC_HAS_FLOAT
+  EKAT_REQUIRE_MSG (not single_precision,
+      "Error! SHOC was not compiled for single precision.\n"
+      "  It requires EAMXX_ENABLE_MIXED_PRECISION_PHYSICS=ON and SHOC small kernels OFF.\n");
+#endif
 
   using SHF  = Functions<Real, DefaultDevice>;
 
@@ -2414,13 +2420,23 @@ Int shoc_main_host(Int shcol, Int nlev, Int nlevi, Real dtime, Int nadv, Int npb
   const int n_trac_slots = ekat::npack<Spack>(num_qtracers+3)*Spack::n;
   ekat::WorkspaceManager<Spack, SHF::KT::Device> workspace_mgr(nlevi_packs, 14+(n_wind_slots+n_trac_slots), policy);
 
-  const auto elapsed_microsec = SHF::shoc_main(shcol, nlev, nlevi, npbl, nadv, num_qtracers, dtime,
-                                               workspace_mgr, shoc_runtime_options,
-                                               shoc_input, shoc_input_output, shoc_output, shoc_history_output
+  Int elapsed_microsec;
+#ifdef SCREAM_SHOC_HAS_FLOAT
+  if (single_precision) {
+    SHOCSinglePrecision shoc_float(shcol, nlev, num_qtracers, shoc_runtime_options,
+                                   shoc_input, shoc_input_output, shoc_output, shoc_history_output);
+    elapsed_microsec = shoc_float.run(npbl, nadv, dtime);
+  } else
+#endif
+  {
+    elapsed_microsec = SHF::shoc_main(shcol, nlev, nlevi, npbl, nadv, num_qtracers, dtime,
+                                      workspace_mgr, shoc_runtime_options,
+                                      shoc_input, shoc_input_output, shoc_output, shoc_history_output
 #ifdef SCREAM_SHOC_SMALL_KERNELS
-                                               , shoc_temporaries
+                                      , shoc_temporaries
 #endif
-                                               );
+                                      );
+  }
 
   // Copy wind back into separate views and
   // Transpose tracers
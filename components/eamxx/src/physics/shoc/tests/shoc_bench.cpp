@@ -0,0 +1,134 @@
+#include "shoc_main_wrap.hpp"
+#include "shoc_data.hpp"
+#include "shoc_ic_cases.hpp"
+
+#include "share/eamxx_types.hpp"
+#include "share/eamxx_session.hpp"
+#include "physics/share/physics_bench_utils.hpp"
+
+#include <Kokkos_Core.hpp>
+
+#include <chrono>
+#include <iostream>
+#include <map>
+#include <vector>
+
+namespace {
+using namespace scream;
+using namespace scream::shoc;
+
+/*
+ * shoc_bench times shoc_main on synthetic columns. Columns start from the
+ * "standard" initial condition, with per-column surface fluxes and tke, so
+ * that the pbl and the assumed pdf differ across columns.
+ *
+ * The same source is compiled against shoc and (if small kernels are off)
+ * against shoc_sk. With small kernels, each sub-step of shoc_main runs as its
+ * own kernel inside a profiling region; the regions are timed here (with a
+ * fence at each boundary) and reported next to the shoc_main total.
+ */
+
+using clock_type = std::chrono::steady_clock;
+
+struct RegionTimer {
+  std::vector<std::pair<std::string,clock_type::time_point>> stack;
+  std::map<std::string,double> elapsed;
+
+  static RegionTimer& get () {
+    static RegionTimer t;
+    return t;
+  }
+
+  static void push (const char* name) {
+    Kokkos::fence();
+    get().stack.emplace_back(name,clock_type::now());
+  }
+  static void pop () {
+    Kokkos::fence();
+    auto& t = get();
+    const auto& top = t.stack.back();
+    t.elapsed[top.first] += std::chrono::duration<double>(clock_type::now()-top.second).count();
+    t.stack.pop_back();
+  }
+};
+
+void perturb_columns (FortranData& d) {
+  for (Int i = 0; i < d.shcol; ++i) {
+    const Real f = 0.5 + (i % 17) / 16.0;
+    d.wthl_sfc(i) *= f;
+    d.wqw_sfc(i)  *= f;
+    for (Int k = 0; k < d.nlev; ++k) {
+      d.tke(i,k) *= f;
+    }
+  }
+}
+
+} // namespace anon
+
+int main (int argc, char** argv) {
+  if (argc > 1 && std::string(argv[1])=="-h") {
+    std::cout <<
+      argv[0] << " [options]\n"
+      "Options:\n" << bench::common_usage() <<
+      "  -dt <seconds>       Length of timestep. Default=300.\n"
+      "  -nadv <steps>       Number of SHOC loops per timestep. Default=15.\n"
+      "  -q <qtracers>       Number of tracers. Default=3.\n";
+    return 0;
+  }
+
+  Real dt = 300;
+  Int nadv = 15;
+  Int num_qtracers = 3;
+  const auto cfg = bench::parse_args(argc, argv, [&](int& i) {
+    const std::string a = argv[i];
+    if (a=="-dt" || a=="--dt") {
+      bench::expect_another_arg(i, argc);
+      dt = std::atof(argv[++i]);
+    } else if (a=="-nadv" || a=="--nadv") {
+      bench::expect_another_arg(i, argc);
+      nadv = std::atoi(argv[++i]);
+    } else if (a=="-q" || a=="--qtracers") {
+      bench::expect_another_arg(i, argc);
+      num_qtracers = std::atoi(argv[++i]);
+    }
+  });
+
+  scream::initialize_eamxx_session(argc, argv);
+  {
+#ifdef SCREAM_SHOC_SMALL_KERNELS
+    Kokkos::Tools::Experimental::set_push_region_callback(RegionTimer::push);
+    Kokkos::Tools::Experimental::set_pop_region_callback(RegionTimer::pop);
+#endif
+
+    bench::Timings timings;
+    for (int r = -cfg.nwarm; r < cfg.nrep; ++r) {
+      const auto d = ic::Factory::create(ic::Factory::standard, cfg.ncol, cfg.nlev, num_qtracers);
+      d->dtime = dt;
+      d->nadv = nadv;
+      perturb_columns(*d);
+
+      RegionTimer::get().elapsed.clear();
+      Int microsec = 0;
+      for (int it = 0; it < cfg.nsteps; ++it) {
+        microsec += shoc_main(*d);
+      }
+      if (r >= 0) {
+        timings.add("shoc_main", 1e-6*microsec);
+        for (const auto& it : RegionTimer::get().elapsed) {
+          timings.add("  " + it.first, it.second);
+        }
+      }
+    }
+
+#ifdef SCREAM_SHOC_SMALL_KERNELS
+    Kokkos::Tools::Experimental::set_push_region_callback(nullptr);
+    Kokkos::Tools::Experimental::set_pop_region_callback(nullptr);
+    timings.report("SHOC (small kernels)", cfg, SCREAM_SMALL_PACK_SIZE);
+#else
+    timings.report("SHOC", cfg, SCREAM_SMALL_PACK_SIZE);
+#endif
+  }
+  scream::finalize_eamxx_session();
+
+  return 0;
+}
@@ -0,0 +1,112 @@
+#include "catch2/catch.hpp"
+
+#include "shoc_main_wrap.hpp"
+#include "shoc_data.hpp"
+#include "shoc_ic_cases.hpp"
+
+#include "physics_constants.hpp"
+#include "share/eamxx_types.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+
+namespace {
+
+using namespace scream;
+using namespace scream::shoc;
+
+/*
+ * Runs shoc_main in double and in float (SHOCSinglePrecision) from the same
+ * initial condition, and checks that
+ *  - the prognostic fields agree within a tolerance that reflects float
+ *    round off, amplified by the nonlinearities of a few SHOC loops;
+ *  - the column total energy changes by the same amount in both runs, that
+ *    is, the float run conserves energy (the energy fixer accumulates in
+ *    double) as well as the double run does.
+ */
+
+std::shared_ptr<FortranData> make_data (const Int ncol, const Int nlev, const Int num_qtracers)
+{
+  auto d = ic::Factory::create(ic::Factory::standard, ncol, nlev, num_qtracers);
+  d->dtime = 300;
+  d->nadv = 3;
+
+  // Make columns differ, so that the pbl and the assumed pdf differ too
+  for (Int i = 0; i < ncol; ++i) {
+    const Real f = 0.5 + i / Real(ncol);
+    d->wthl_sfc(i) *= f;
+    d->wqw_sfc(i)  *= f;
+    for (Int k = 0; k < nlev; ++k) {
+      d->tke(i,k) *= f;
+    }
+  }
+  return d;
+}
+
+// Max-norm of the difference, relative to the max-norm of the reference
+Real rel_diff (const FortranData::Array2& f, const FortranData::Array2& d)
+{
+  Real diff = 0, norm = 0;
+  for (size_t i = 0; i < d.extent(0); ++i) {
+    for (size_t k = 0; k < d.extent(1); ++k) {
+      diff = std::max(diff, std::abs(f(i,k) - d(i,k)));
+      norm = std::max(norm, std::abs(d(i,k)));
+    }
+  }
+  return norm > 0 ? diff / norm : diff;
+}
+
+// Column total energy, as in the SHOC energy fixer
+Real total_energy (const FortranData& d, const Int icol)
+{
+  using PC = scream::physics::Constants<Real>;
+  const Real lcond = PC::LatVap;
+  const Real lice  = PC::LatIce;
+  Real te = 0;
+  for (Int k = 0; k < d.nlev; ++k) {
+    const Real ke = 0.5*(d.u_wind(icol,k)*d.u_wind(icol,k) + d.v_wind(icol,k)*d.v_wind(icol,k));
+    const Real wv = d.qw(icol,k) - d.shoc_ql(icol,k);
+    const Real wl = d.shoc_ql(icol,k);
+    te += (d.host_dse(icol,k) + ke + (lcond+lice)*wv + lice*wl)*d.pdel(icol,k)/PC::gravit;
+  }
+  return te;
+}
+
+TEST_CASE("shoc_mixed_precision", "shoc")
+{
+  const Int ncol = 8;
+  const Int nlev = 72;
+  const Int num_qtracers = 3;
+
+  const auto d0   = make_data(ncol, nlev, num_qtracers);
+  const auto d_dp = make_data(ncol, nlev, num_qtracers);
+  const auto d_sp = make_data(ncol, nlev, num_qtracers);
+
+  shoc_main(*d_dp, false);
+  shoc_main(*d_sp, true);
+
+  SECTION ("agreement") {
+    const Real tol = 1e-3;
+    const Real tol_tke = 5e-2;
+    REQUIRE (rel_diff(d_sp->host_dse,d_dp->host_dse) <= tol);
+    REQUIRE (rel_diff(d_sp->thetal,  d_dp->thetal)   <= tol);
+    REQUIRE (rel_diff(d_sp->qw,      d_dp->qw)       <= tol);
+    REQUIRE (rel_diff(d_sp->u_wind,  d_dp->u_wind)   <= tol);
+    REQUIRE (rel_diff(d_sp->v_wind,  d_dp->v_wind)   <= tol);
+    REQUIRE (rel_diff(d_sp->tke,     d_dp->tke)      <= tol_tke);
+  }
+
+  SECTION ("energy_conservation") {
+    // Float round off of host_dse, relative to the column energy
+    const Real tol = 1e-5;
+    for (Int i = 0; i < ncol; ++i) {
+      const Real te0 = total_energy(*d0,i);
+      const Real dte_dp = total_energy(*d_dp,i) - te0;
+      const Real dte_sp = total_energy(*d_sp,i) - te0;
+      REQUIRE (std::abs(dte_sp - dte_dp) <= tol*std::abs(te0));
+    }
+  }
+}
+
+} // anonymous namespace
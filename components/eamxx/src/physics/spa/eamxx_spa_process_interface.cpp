@@ -108,6 +108,7 @@ void SPA::initialize_impl (const RunType /* run_type */)
   vremap_data.pmid = pmid;
   vremap_data.pint = pint;
   m_data_interpolation->create_vert_remapper (vremap_data);
+  m_data_interpolation->toggle_read_only_needed_cols (m_params.get<bool>("spa_read_only_needed_cols",false));
   m_data_interpolation->init_data_interval (start_of_step_ts());
 
   // Set property checks for fields in this process
@@ -123,6 +124,13 @@ void SPA::initialize_impl (const RunType /* run_type */)
   add_postcondition_check<FWI>(get_field_out("aero_tau_lw"),m_model_grid,0.0,1.0,true);
 }
 
+// =========================================================================================
+void SPA::reset_state_impl ()
+{
+  // Reload the data slices around the new start time
+  m_data_interpolation->init_data_interval (start_of_step_ts());
+}
+
 // =========================================================================================
 void SPA::run_impl (const double /* dt */)
 {
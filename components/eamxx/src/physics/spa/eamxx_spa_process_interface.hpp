@@ -36,6 +36,7 @@ protected:
   void initialize_impl (const RunType run_type);
   void run_impl        (const double dt);
   void finalize_impl   () { /* Nothing to do */ }
+  void reset_state_impl ();
 
   std::shared_ptr<const AbstractGrid>   m_model_grid;
 
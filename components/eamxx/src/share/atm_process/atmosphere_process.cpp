@@ -20,6 +20,8 @@ namespace py = pybind11;
 namespace scream
 {
 
+long long AtmosphereProcess::s_global_run_count = 0;
+
 ekat::logger::LogLevel str2LogLevel (const std::string& s) {
   using namespace ekat::logger;
 
@@ -121,9 +123,19 @@ void AtmosphereProcess::initialize (const TimeStamp& t0, const RunType run_type)
   }
 }
 
+void AtmosphereProcess::reset_state (const TimeStamp& t0) {
+  EKAT_REQUIRE_MSG (supports_state_reset(),
+      "Error! This atmosphere process does not support resetting its state.\n"
+      " - process name: " + name() + "\n");
+
+  m_start_of_step_ts = m_end_of_step_ts = t0;
+  reset_state_impl();
+}
+
 void AtmosphereProcess::run (const double dt) {
   m_atm_logger->debug("[EAMxx::" + this->name() + "] run...");
   start_timer (m_timer_prefix + this->name() + "::run");
+  ++s_global_run_count;
   if (m_params.get("enable_precondition_checks", true)) {
     // Run 'pre-condition' property checks stored in this AP
     run_precondition_checks();
@@ -114,6 +114,16 @@ public:
   void run (const double dt);
   void finalize ();
 
+  // Prepare an already initialized process for a new initial run starting at t0,
+  // after the fields have been reset (e.g., to run another ensemble member).
+  // Unlike initialize, this must not redo any expensive setup (tables, remappers,
+  // buffers,...), but only reset the state that the process keeps internally.
+  void reset_state (const TimeStamp& t0);
+
+  // Processes whose internal state cannot be reset (without re-creating the
+  // process) must override this method, returning false.
+  virtual bool supports_state_reset () const { return true; }
+
   // Return the MPI communicator
   const ekat::Comm& get_comm () const { return m_comm; }
 
@@ -129,6 +139,10 @@ public:
   //       or that of the output fields.
   void set_update_time_stamps (const bool do_update);
 
+  // Number of times the run method of *any* atm process has been called.
+  // Processes can use it to check whether some other process ran since a given point.
+  static long long get_global_run_count () { return s_global_run_count; }
+
   // These methods set fields/groups in the atm process. The fields/groups are stored
   // in a list (with some helpers maps that can be used to quickly retrieve them).
   // If derived class need additional bookkeping/checks, they can override the
@@ -441,6 +455,10 @@ protected:
   // Override this method to finalize the derived class
   virtual void finalize_impl(/* what inputs? */) = 0;
 
+  // Override this method if the derived class keeps some internal state
+  // that has to be reset at the beginning of a new run (see reset_state)
+  virtual void reset_state_impl () {}
+
   // This provides access to this process's timestamp.
   // NOTE: start_of_step_ts/end_of_step_ts are the TimeStamp at the start/end
   //       of the current subcycle (at run time).
@@ -600,6 +618,9 @@ private:
   // Whether we need to update time stamps at the end of the run method
   bool m_update_time_stamps = true;
 
+  // Incremented at the beginning of each call to run (see get_global_run_count)
+  static long long s_global_run_count;
+
   // Whether this atm proc should compute tendencies for any of its updated fields
   bool m_compute_proc_tendencies = false;
 
@@ -437,6 +437,21 @@ void AtmosphereProcessGroup::pre_process_tracer_requests () {
   }
 }
 
+bool AtmosphereProcessGroup::supports_state_reset () const {
+  for (const auto& atm_proc : m_atm_processes) {
+    if (not atm_proc->supports_state_reset()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void AtmosphereProcessGroup::reset_state_impl () {
+  for (auto& atm_proc : m_atm_processes) {
+    atm_proc->reset_state(start_of_step_ts());
+  }
+}
+
 void AtmosphereProcessGroup::initialize_impl (const RunType run_type) {
   for (auto& atm_proc : m_atm_processes) {
     atm_proc->initialize(start_of_step_ts(),run_type);
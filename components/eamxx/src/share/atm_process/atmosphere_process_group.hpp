@@ -87,6 +87,9 @@ public:
   //       of internal fields of the group.
   void gather_internal_fields ();
 
+  // The group state can be reset only if that of all its processes can
+  bool supports_state_reset () const;
+
   // Returns true if any internal processes enables
   // the mass and energy conservation checks.
   bool are_column_conservation_checks_enabled () const;
@@ -128,6 +131,7 @@ protected:
   void initialize_impl ();
   void run_impl        (const double dt);
   void finalize_impl   (/* what inputs? */);
+  void reset_state_impl ();
 
   void run_sequential (const double dt);
   void run_parallel   (const double dt);
@@ -16,6 +16,15 @@ using Real = double;
 using Real = float;
 #endif
 
+// Number of entries in a pack of type S that has the same size (in bytes) as a
+// pack of n Real's. Reduced precision packs (e.g., float packs in a double
+// precision build) are therefore wider, filling the same SIMD registers.
+// Packs of size 1 (e.g., on GPU) are not widened.
+template<typename S, int n>
+constexpr int pack_size_for () {
+  return (n>1 && sizeof(S)<sizeof(Real)) ? n*static_cast<int>(sizeof(Real)/sizeof(S)) : n;
+}
+
 // Kokkos types
 using ekat::KokkosTypes;
 using ekat::DefaultDevice;
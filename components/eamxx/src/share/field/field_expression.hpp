@@ -0,0 +1,485 @@
+#ifndef SCREAM_FIELD_EXPRESSION_HPP
+#define SCREAM_FIELD_EXPRESSION_HPP
+
+#include "share/field/field.hpp"
+
+#include <ekat/ekat_assert.hpp>
+
+#include <type_traits>
+
+namespace scream
+{
+
+/*
+ * Lazy elementwise algebra over Fields
+ *
+ * Arithmetic on Fields and scalars does not touch any data: it builds an
+ * expression tree on host, which is evaluated by assign in a single kernel
+ * over the output field. E.g.,
+ *
+ *   assign(y, alpha*x + beta*w/z);
+ *   assign(y, where(mask, fill_value, y/expr::as<int>(count)));
+ *
+ * read each input once and write y once, while the equivalent sequence of
+ * Field::update/scale/scale_inv/deep_copy calls makes a full pass over y
+ * for each call.
+ *
+ * Supported: + - * / (binary), unary -, < <= > >=, expr::eq/ne/max/min, and
+ * where(cond,a,b), where cond is a comparison or an int field (nonzero=true).
+ * Note: == and != are not overloaded, since Field==Field compares identity.
+ * Fields are read as Real, unless wrapped with expr::as<T>(f). All fields in
+ * the expression must have a layout congruent with the one of y, and can be
+ * subfields. The output field y can also appear in the expression.
+ */
+
+namespace expr {
+
+namespace impl {
+
+// ------------------- Device-side nodes ------------------- //
+
+template<typename ST, int N, bool Strided>
+struct FieldNode {
+  using data_t  = Field::data_nd_t<const ST,N>;
+  using view_t  = typename std::conditional<Strided,
+                                            Field::get_strided_view_type<data_t,Device>,
+                                            Field::get_view_type<data_t,Device>>::type;
+  using value_type = ST;
+
+  view_t v;
+
+  template<typename... Idx>
+  KOKKOS_INLINE_FUNCTION
+  value_type operator() (Idx... i) const { return v(i...); }
+};
+
+template<typename ST>
+struct ScalarNode {
+  using value_type = ST;
+
+  ST val;
+
+  template<typename... Idx>
+  KOKKOS_INLINE_FUNCTION
+  value_type operator() (Idx...) const { return val; }
+};
+
+template<typename Op, typename L, typename R>
+struct BinaryNode {
+  using value_type = decltype(Op::apply(std::declval<typename L::value_type>(),
+                                        std::declval<typename R::value_type>()));
+  L l;
+  R r;
+
+  template<typename... Idx>
+  KOKKOS_INLINE_FUNCTION
+  value_type operator() (Idx... i) const { return Op::apply(l(i...),r(i...)); }
+};
+
+template<typename Op, typename A>
+struct UnaryNode {
+  using value_type = decltype(Op::apply(std::declval<typename A::value_type>()));
+  A a;
+
+  template<typename... Idx>
+  KOKKOS_INLINE_FUNCTION
+  value_type operator() (Idx... i) const { return Op::apply(a(i...)); }
+};
+
+template<typename C, typename A, typename B>
+struct WhereNode {
+  using value_type = typename std::common_type<typename A::value_type,
+                                               typename B::value_type>::type;
+  C c;
+  A a;
+  B b;
+
+  // Only the selected branch is evaluated
+  template<typename... Idx>
+  KOKKOS_INLINE_FUNCTION
+  value_type operator() (Idx... i) const {
+    return c(i...) ? static_cast<value_type>(a(i...))
+                   : static_cast<value_type>(b(i...));
+  }
+};
+
+// ------------------- Operations ------------------- //
+
+#define SCREAM_EXPR_BINARY_OP(NAME,EXPR)                  \
+  struct NAME {                                           \
+    template<typename A, typename B>                      \
+    KOKKOS_INLINE_FUNCTION                                \
+    static auto apply (const A a, const B b) { return EXPR; } \
+  }
+
+SCREAM_EXPR_BINARY_OP(Plus,  a+b);
+SCREAM_EXPR_BINARY_OP(Minus, a-b);
+SCREAM_EXPR_BINARY_OP(Times, a*b);
+SCREAM_EXPR_BINARY_OP(Div,   a/b);
+SCREAM_EXPR_BINARY_OP(Max,   (a>b ? static_cast<std::common_type_t<A,B>>(a) : static_cast<std::common_type_t<A,B>>(b)));
+SCREAM_EXPR_BINARY_OP(Min,   (a<b ? static_cast<std::common_type_t<A,B>>(a) : static_cast<std::common_type_t<A,B>>(b)));
+SCREAM_EXPR_BINARY_OP(EQ,    a==b);
+SCREAM_EXPR_BINARY_OP(NE,    a!=b);
+SCREAM_EXPR_BINARY_OP(LT,    a<b);
+SCREAM_EXPR_BINARY_OP(LE,    a<=b);
+SCREAM_EXPR_BINARY_OP(GT,    a>b);
+SCREAM_EXPR_BINARY_OP(GE,    a>=b);
+
+#undef SCREAM_EXPR_BINARY_OP
+
+struct Negate {
+  template<typename A>
+  KOKKOS_INLINE_FUNCTION
+  static auto apply (const A a) { return -a; }
+};
+
+// ------------------- Host-side terms ------------------- //
+
+// Each term knows how to check its fields against the output layout, and
+// how to create the device node for a given rank and view layout.
+
+template<typename ST>
+struct FieldTerm {
+  using value_type = ST;
+
+  Field f;
+
+  void check (const Field& y) const {
+    EKAT_REQUIRE_MSG (f.is_allocated(),
+        "Error! Field in expression was not yet allocated.\n"
+        " - field name: " + f.name() + "\n");
+    EKAT_REQUIRE_MSG (f.data_type()==get_data_type<ST>(),
+        "Error! Field in expression does not have the expected data type.\n"
+        " - field name: " + f.name() + "\n"
+        " - field data type: " + e2str(f.data_type()) + "\n"
+        " - expected data type: " + e2str(get_data_type<ST>()) + "\n"
+        "   Use expr::as<T>(f) to read a field with a data type different from Real.\n");
+    const auto& fl = f.get_header().get_identifier().get_layout();
+    const auto& yl = y.get_header().get_identifier().get_layout();
+    EKAT_REQUIRE_MSG (fl.congruent(yl),
+        "Error! Field in expression has a layout incompatible with the output field.\n"
+        " - field name   : " + f.name() + "\n"
+        " - output name  : " + y.name() + "\n"
+        " - field layout : " + fl.to_string() + "\n"
+        " - output layout: " + yl.to_string() + "\n");
+  }
+  bool contiguous () const { return f.get_header().get_alloc_properties().contiguous(); }
+
+  template<int N, bool Strided>
+  FieldNode<ST,N,Strided> bind () const {
+    using node_t = FieldNode<ST,N,Strided>;
+    if constexpr (Strided) {
+      return node_t{f.get_strided_view<typename node_t::data_t,Device>()};
+    } else {
+      return node_t{f.get_view<typename node_t::data_t,Device>()};
+    }
+  }
+};
+
+template<typename ST>
+struct ScalarTerm {
+  using value_type = ST;
+
+  ST val;
+
+  void check (const Field&) const {}
+  bool contiguous () const { return true; }
+
+  template<int N, bool Strided>
+  ScalarNode<ST> bind () const { return ScalarNode<ST>{val}; }
+};
+
+template<typename Op, typename L, typename R>
+struct BinaryTerm {
+  using value_type = decltype(Op::apply(std::declval<typename L::value_type>(),
+                                        std::declval<typename R::value_type>()));
+  L l;
+  R r;
+
+  void check (const Field& y) const { l.check(y); r.check(y); }
+  bool contiguous () const { return l.contiguous() and r.contiguous(); }
+
+  template<int N, bool Strided>
+  auto bind () const {
+    using LN = decltype(l.template bind<N,Strided>());
+    using RN = decltype(r.template bind<N,Strided>());
+    return BinaryNode<Op,LN,RN>{l.template bind<N,Strided>(),r.template bind<N,Strided>()};
+  }
+};
+
+template<typename Op, typename A>
+struct UnaryTerm {
+  using value_type = decltype(Op::apply(std::declval<typename A::value_type>()));
+  A a;
+
+  void check (const Field& y) const { a.check(y); }
+  bool contiguous () const { return a.contiguous(); }
+
+  template<int N, bool Strided>
+  auto bind () const {
+    using AN = decltype(a.template bind<N,Strided>());
+    return UnaryNode<Op,AN>{a.template bind<N,Strided>()};
+  }
+};
+
+template<typename C, typename A, typename B>
+struct WhereTerm {
+  using value_type = typename std::common_type<typename A::value_type,
+                                               typename B::value_type>::type;
+  C c;
+  A a;
+  B b;
+
+  void check (const Field& y) const { c.check(y); a.check(y); b.check(y); }
+  bool contiguous () const { return c.contiguous() and a.contiguous() and b.contiguous(); }
+
+  template<int N, bool Strided>
+  auto bind () const {
+    using CN = decltype(c.template bind<N,Strided>());
+    using AN = decltype(a.template bind<N,Strided>());
+    using BN = decltype(b.template bind<N,Strided>());
+    return WhereNode<CN,AN,BN>{c.template bind<N,Strided>(),
+                               a.template bind<N,Strided>(),
+                               b.template bind<N,Strided>()};
+  }
+};
+
+// ------------------- Traits and conversions ------------------- //
+
+template<typename T> struct is_term : std::false_type {};
+template<typename ST> struct is_term<FieldTerm<ST>> : std::true_type {};
+template<typename ST> struct is_term<ScalarTerm<ST>> : std::true_type {};
+template<typename Op, typename L, typename R> struct is_term<BinaryTerm<Op,L,R>> : std::true_type {};
+template<typename Op, typename A> struct is_term<UnaryTerm<Op,A>> : std::true_type {};
+template<typename C, typename A, typename B> struct is_term<WhereTerm<C,A,B>> : std::true_type {};
+
+// A term or a Field: at least one of these is needed to trigger the operators below
+template<typename T>
+constexpr bool is_lazy_v = is_term<T>::value or std::is_same<T,Field>::value;
+
+template<typename T>
+constexpr bool is_operand_v = is_lazy_v<T> or std::is_arithmetic<T>::value;
+
+template<typename L, typename R>
+using enable_if_operands_t = std::enable_if_t<is_operand_v<L> and is_operand_v<R> and
+                                              (is_lazy_v<L> or is_lazy_v<R>)>;
+
+template<typename T>
+auto to_term (const T& t) {
+  if constexpr (std::is_same<T,Field>::value) {
+    return FieldTerm<Real>{t};
+  } else if constexpr (std::is_arithmetic<T>::value) {
+    return ScalarTerm<T>{t};
+  } else {
+    return t;
+  }
+}
+
+// Masks are int fields, where a nonzero entry means true
+template<typename T>
+auto to_cond_term (const T& t) {
+  if constexpr (std::is_same<T,Field>::value) {
+    return FieldTerm<int>{t};
+  } else {
+    return to_term(t);
+  }
+}
+
+template<typename Op, typename L, typename R>
+auto make_binary (const L& l, const R& r) {
+  using LT = decltype(to_term(l));
+  using RT = decltype(to_term(r));
+  return BinaryTerm<Op,LT,RT>{to_term(l),to_term(r)};
+}
+
+// ------------------- Evaluation ------------------- //
+
+template<typename LhsView, typename Rhs>
+struct AssignHelper {
+  using exec_space = typename LhsView::traits::execution_space;
+  using value_type = typename LhsView::traits::non_const_value_type;
+
+  static constexpr int N = LhsView::rank();
+
+  template<int M>
+  using MDRange = Kokkos::MDRangePolicy<
+                    exec_space,
+                    Kokkos::Rank<M,Kokkos::Iterate::Right,Kokkos::Iterate::Right>
+                  >;
+
+  void run (const std::vector<int>& dims) const {
+    if constexpr (N==0) {
+      Kokkos::parallel_for(Kokkos::RangePolicy<exec_space>(0,1),*this);
+    } else if constexpr (N==1) {
+      Kokkos::parallel_for(Kokkos::RangePolicy<exec_space>(0,dims[0]),*this);
+    } else if constexpr (N==2) {
+      Kokkos::parallel_for(MDRange<2>({0,0},{dims[0],dims[1]}),*this);
+    } else if constexpr (N==3) {
+      Kokkos::parallel_for(MDRange<3>({0,0,0},{dims[0],dims[1],dims[2]}),*this);
+    } else if constexpr (N==4) {
+      Kokkos::parallel_for(MDRange<4>({0,0,0,0},{dims[0],dims[1],dims[2],dims[3]}),*this);
+    } else if constexpr (N==5) {
+      Kokkos::parallel_for(MDRange<5>({0,0,0,0,0},{dims[0],dims[1],dims[2],dims[3],dims[4]}),*this);
+    } else {
+      Kokkos::parallel_for(MDRange<6>({0,0,0,0,0,0},{dims[0],dims[1],dims[2],dims[3],dims[4],dims[5]}),*this);
+    }
+  }
+
+  template<typename... Idx>
+  KOKKOS_INLINE_FUNCTION
+  void operator() (Idx... i) const {
+    if constexpr (N==0) {
+      lhs() = static_cast<value_type>(rhs());
+    } else {
+      lhs(i...) = static_cast<value_type>(rhs(i...));
+    }
+  }
+
+  LhsView lhs;
+  Rhs     rhs;
+};
+
+template<typename ST, int N, bool Strided, typename Term>
+void assign_impl (const Field& y, const Term& t)
+{
+  using data_t = Field::data_nd_t<ST,N>;
+  const auto& dims = y.get_header().get_identifier().get_layout().dims();
+  const auto rhs = t.template bind<N,Strided>();
+  if constexpr (Strided) {
+    using LhsView = Field::get_strided_view_type<data_t,Device>;
+    AssignHelper<LhsView,decltype(rhs)>{y.get_strided_view<data_t,Device>(),rhs}.run(dims);
+  } else {
+    using LhsView = Field::get_view_type<data_t,Device>;
+    AssignHelper<LhsView,decltype(rhs)>{y.get_view<data_t,Device>(),rhs}.run(dims);
+  }
+}
+
+template<typename ST, bool Strided, typename Term>
+void assign_rank (const Field& y, const Term& t)
+{
+  switch (y.rank()) {
+    case 0: assign_impl<ST,0,Strided>(y,t); break;
+    case 1: assign_impl<ST,1,Strided>(y,t); break;
+    case 2: assign_impl<ST,2,Strided>(y,t); break;
+    case 3: assign_impl<ST,3,Strided>(y,t); break;
+    case 4: assign_impl<ST,4,Strided>(y,t); break;
+    case 5: assign_impl<ST,5,Strided>(y,t); break;
+    case 6: assign_impl<ST,6,Strided>(y,t); break;
+    default:
+      EKAT_ERROR_MSG ("Error! Unsupported field rank in expression assignment.\n"
+          " - field name: " + y.name() + "\n"
+          " - field rank: " + std::to_string(y.rank()) + "\n");
+  }
+}
+
+template<typename ST, typename Term>
+void assign_typed (const Field& y, const Term& t)
+{
+  // Use LayoutRight views (better vectorization) unless some field is a non-contiguous subfield
+  const bool contiguous = t.contiguous() and y.get_header().get_alloc_properties().contiguous();
+  if (contiguous) {
+    assign_rank<ST,false>(y,t);
+  } else {
+    assign_rank<ST,true>(y,t);
+  }
+}
+
+} // namespace impl
+
+// Read a field with data type T (default is Real)
+template<typename T>
+impl::FieldTerm<T> as (const Field& f) { return impl::FieldTerm<T>{f}; }
+
+// ------------------- Operators ------------------- //
+
+#define SCREAM_EXPR_OPERATOR(OP,NAME)                                   \
+  template<typename L, typename R, typename = impl::enable_if_operands_t<L,R>> \
+  auto OP (const L& l, const R& r) { return impl::make_binary<impl::NAME>(l,r); }
+
+SCREAM_EXPR_OPERATOR(operator+,  Plus)
+SCREAM_EXPR_OPERATOR(operator-,  Minus)
+SCREAM_EXPR_OPERATOR(operator*,  Times)
+SCREAM_EXPR_OPERATOR(operator/,  Div)
+SCREAM_EXPR_OPERATOR(operator<,  LT)
+SCREAM_EXPR_OPERATOR(operator<=, LE)
+SCREAM_EXPR_OPERATOR(operator>,  GT)
+SCREAM_EXPR_OPERATOR(operator>=, GE)
+SCREAM_EXPR_OPERATOR(eq,         EQ)
+SCREAM_EXPR_OPERATOR(ne,         NE)
+SCREAM_EXPR_OPERATOR(max,        Max)
+SCREAM_EXPR_OPERATOR(min,        Min)
+
+#undef SCREAM_EXPR_OPERATOR
+
+template<typename A, typename = std::enable_if_t<impl::is_lazy_v<A>>>
+auto operator- (const A& a) {
+  using AT = decltype(impl::to_term(a));
+  return impl::UnaryTerm<impl::Negate,AT>{impl::to_term(a)};
+}
+
+// Select a where cond is true, and b elsewhere
+template<typename C, typename A, typename B,
+         typename = std::enable_if_t<impl::is_lazy_v<C> and
+                                     impl::is_operand_v<A> and
+                                     impl::is_operand_v<B>>>
+auto where (const C& cond, const A& a, const B& b) {
+  using CT = decltype(impl::to_cond_term(cond));
+  using AT = decltype(impl::to_term(a));
+  using BT = decltype(impl::to_term(b));
+  return impl::WhereTerm<CT,AT,BT>{impl::to_cond_term(cond),impl::to_term(a),impl::to_term(b)};
+}
+
+// Make the operators visible via ADL for terms (which live in impl)
+namespace impl {
+using expr::operator+;
+using expr::operator-;
+using expr::operator*;
+using expr::operator/;
+using expr::operator<;
+using expr::operator<=;
+using expr::operator>;
+using expr::operator>=;
+} // namespace impl
+
+} // namespace expr
+
+// Make the operators visible via ADL for expressions involving only Fields
+using expr::operator+;
+using expr::operator-;
+using expr::operator*;
+using expr::operator/;
+using expr::operator<;
+using expr::operator<=;
+using expr::operator>;
+using expr::operator>=;
+using expr::where;
+
+// Evaluate the expression e into y (on device), with a single kernel.
+// The result is converted to the data type of y.
+template<typename E>
+void assign (const Field& y, const E& e)
+{
+  EKAT_REQUIRE_MSG (y.is_allocated(),
+      "Error! Output field of expression was not yet allocated.\n"
+      " - field name: " + y.name() + "\n");
+  EKAT_REQUIRE_MSG (not y.is_read_only(),
+      "Error! Cannot assign an expression to a read-only field.\n"
+      " - field name: " + y.name() + "\n");
+
+  const auto t = expr::impl::to_term(e);
+  t.check(y);
+
+  switch (y.data_type()) {
+    case DataType::IntType:    expr::impl::assign_typed<int>(y,t);    break;
+    case DataType::FloatType:  expr::impl::assign_typed<float>(y,t);  break;
+    case DataType::DoubleType: expr::impl::assign_typed<double>(y,t); break;
+    default:
+      EKAT_ERROR_MSG ("Error! Unsupported data type for expression assignment.\n"
+          " - field name: " + y.name() + "\n"
+          " - data type : " + e2str(y.data_type()) + "\n");
+  }
+}
+
+} // namespace scream
+
+#endif // SCREAM_FIELD_EXPRESSION_HPP
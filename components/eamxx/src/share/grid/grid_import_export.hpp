@@ -29,7 +29,8 @@ namespace scream
  * Import/Export data plans can be used both for scattering
  * and gathering data. The user can use the gather/scatter
  * methods for this, but pay attention to their limitations:
- *   - they create send/recv requests at every call (no persistent requests)
+ *   - they create send/recv requests at every call (no persistent requests),
+ *     except for data that stays on the same rank, which is copied directly
  *   - they assume same data type on origin/target ranks
  *   - they operate on a particular input/output data ortanization,
  *     namely, data is organized as a map lid->vector<T>
@@ -118,6 +119,7 @@ protected:
 // uses m_unique grid, the other uses m_overlapped grid, and where one use m_export_lids/pids,
 // the other uses m_import_lids/pids. That's b/c they do the same operation, just
 // in opposite directions.
+// If pid1==pid2, no message is sent: at each stage, the data is copied to the recv maps.
 
 template<typename T>
 void GridImportExport::
@@ -134,6 +136,15 @@ scatter (const MPI_Datatype mpi_data_t,
   auto mpi_comm = m_comm.mpi_comm();
   auto mpi_gid_t = ekat::get_mpi_type<gid_type>();
 
+  // Transfers to/from this rank do not go through MPI: the data is copied directly
+  const int me = m_comm.rank();
+  auto copy_self = [&](auto& recv_map, const auto& send_map) {
+    auto it = send_map.find(me);
+    if (it!=send_map.end()) {
+      recv_map[me] = it->second;
+    }
+  };
+
   auto gids_h = m_unique->get_dofs_gids().get_view<const gid_type*,Host>();
 
   // 1. Communicate GIDs lists to recv pids
@@ -144,6 +155,7 @@ scatter (const MPI_Datatype mpi_data_t,
     send_pid2gids[pid].push_back(gids_h[lid]);
   }
   for (auto& [pid,gids] : send_pid2gids) {
+    if (pid==me) continue;
     auto& req = send_req.emplace_back();
     check_mpi_call(MPI_Isend (gids.data(),gids.size(),mpi_gid_t,pid,tag,mpi_comm,&req),
                    "GridImportExport::scatter, creating send request (step 1)");
@@ -154,6 +166,7 @@ scatter (const MPI_Datatype mpi_data_t,
     recv_pid2gids[pid].push_back(-1);
   }
   for (auto& [pid,gids] : recv_pid2gids) {
+    if (pid==me) continue;
     auto& req = recv_req.emplace_back();
     check_mpi_call(MPI_Irecv (gids.data(),gids.size(),mpi_gid_t,pid,tag,mpi_comm,&req),
                    "GridImportExport::scatter, creating recv request (step 1)");
@@ -164,6 +177,7 @@ scatter (const MPI_Datatype mpi_data_t,
                  "GridImportExport::scatter, waiting on recv requests (step 1)");
   send_req.clear();
   recv_req.clear();
+  copy_self(recv_pid2gids,send_pid2gids);
   
   // 2. Communicate T's count for each GID to recv pids
   std::map<int,std::vector<int>> send_pid2count;
@@ -173,6 +187,7 @@ scatter (const MPI_Datatype mpi_data_t,
     send_pid2count[pid].push_back(src.at(lid).size());
   }
   for (auto& [pid,count] : send_pid2count) {
+    if (pid==me) continue;
     auto& req = send_req.emplace_back();
     check_mpi_call(MPI_Isend (count.data(),count.size(),MPI_INT,pid,tag,mpi_comm,&req),
                    "GridImportExport::scatter, creating send request (step 2)");
@@ -183,6 +198,7 @@ scatter (const MPI_Datatype mpi_data_t,
     recv_pid2count[pid].resize(gids.size());
   }
   for (auto& [pid,count] : recv_pid2count) {
+    if (pid==me) continue;
     auto& req = recv_req.emplace_back();
     check_mpi_call(MPI_Irecv (count.data(),count.size(),MPI_INT,pid,tag,mpi_comm,&req),
                    "GridImportExport::scatter, creating recv request (step 2)");
@@ -193,6 +209,7 @@ scatter (const MPI_Datatype mpi_data_t,
                  "GridImportExport::scatter, waiting on recv requests (step 2)");
   send_req.clear();
   recv_req.clear();
+  copy_self(recv_pid2count,send_pid2count);
 
   // 3. Pack and send the data.
   std::map<int,std::vector<T>> send_pid2data;
@@ -205,6 +222,7 @@ scatter (const MPI_Datatype mpi_data_t,
     }
   }
   for (auto& [pid,data] : send_pid2data) {
+    if (pid==me) continue;
     auto& req = send_req.emplace_back();
     check_mpi_call(MPI_Isend (data.data(),data.size(),mpi_data_t,pid,tag,mpi_comm,&req),
                    "GridImportExport::scatter, creating send request (step 3)");
@@ -219,6 +237,7 @@ scatter (const MPI_Datatype mpi_data_t,
     data.resize(n);
   }
   for (auto& [pid,data] : recv_pid2data) {
+    if (pid==me) continue;
     auto& req = recv_req.emplace_back();
     check_mpi_call(MPI_Irecv (data.data(),data.size(),mpi_data_t,pid,tag,mpi_comm,&req),
                    "GridImportExport::scatter, creating recv request (step 3)");
@@ -229,6 +248,7 @@ scatter (const MPI_Datatype mpi_data_t,
                  "GridImportExport::scatter, waiting on recv requests (step 3)");
   send_req.clear();
   recv_req.clear();
+  copy_self(recv_pid2data,send_pid2data);
 
   // 4. Unpack received data in dst map
   const auto& recv_gid2lid = m_overlapped->get_gid2lid_map();
@@ -262,6 +282,15 @@ gather (const MPI_Datatype mpi_data_t,
   auto mpi_comm = m_comm.mpi_comm();
   auto mpi_gid_t = ekat::get_mpi_type<gid_type>();
 
+  // Transfers to/from this rank do not go through MPI: the data is copied directly
+  const int me = m_comm.rank();
+  auto copy_self = [&](auto& recv_map, const auto& send_map) {
+    auto it = send_map.find(me);
+    if (it!=send_map.end()) {
+      recv_map[me] = it->second;
+    }
+  };
+
   auto ov_gids_h = m_overlapped->get_dofs_gids().get_view<const gid_type*,Host>();
 
   // 1. Communicate GIDs lists to recv pids
@@ -272,6 +301,7 @@ gather (const MPI_Datatype mpi_data_t,
     send_pid2gids[pid].push_back(ov_gids_h[lid]);
   }
   for (auto& [pid,gids] : send_pid2gids) {
+    if (pid==me) continue;
     auto& req = send_req.emplace_back();
     check_mpi_call(MPI_Isend (gids.data(),gids.size(),mpi_gid_t,pid,tag,mpi_comm,&req),
                    "GridImportExport::gather, creating send request (step 1)");
@@ -282,6 +312,7 @@ gather (const MPI_Datatype mpi_data_t,
     recv_pid2gids[pid].push_back(-1);
   }
   for (auto& [pid,gids] : recv_pid2gids) {
+    if (pid==me) continue;
     auto& req = recv_req.emplace_back();
     check_mpi_call(MPI_Irecv (gids.data(),gids.size(),mpi_gid_t,pid,tag,mpi_comm,&req),
                    "GridImportExport::gather, creating recv request (step 1)");
@@ -292,6 +323,7 @@ gather (const MPI_Datatype mpi_data_t,
                  "GridImportExport::gather, waiting on recv requests (step 1)");
   send_req.clear();
   recv_req.clear();
+  copy_self(recv_pid2gids,send_pid2gids);
   
   // 2. Communicate T's count for each GID to recv pids
   std::map<int,std::vector<int>> send_pid2count;
@@ -301,6 +333,7 @@ gather (const MPI_Datatype mpi_data_t,
     send_pid2count[pid].push_back(src.at(lid).size());
   }
   for (auto& [pid,count] : send_pid2count) {
+    if (pid==me) continue;
     auto& req = send_req.emplace_back();
     check_mpi_call(MPI_Isend (count.data(),count.size(),MPI_INT,pid,tag,mpi_comm,&req),
                    "GridImportExport::gather, creating send request (step 2)");
@@ -311,6 +344,7 @@ gather (const MPI_Datatype mpi_data_t,
     recv_pid2count[pid].resize(gids.size());
   }
   for (auto& [pid,count] : recv_pid2count) {
+    if (pid==me) continue;
     auto& req = recv_req.emplace_back();
     check_mpi_call(MPI_Irecv (count.data(),count.size(),MPI_INT,pid,tag,mpi_comm,&req),
                    "GridImportExport::gather, creating recv request (step 2)");
@@ -321,6 +355,7 @@ gather (const MPI_Datatype mpi_data_t,
                  "GridImportExport::gather, waiting on recv requests (step 2)");
   send_req.clear();
   recv_req.clear();
+  copy_self(recv_pid2count,send_pid2count);
 
   // 3. Pack and send the data.
   std::map<int,std::vector<T>> send_pid2data;
@@ -333,6 +368,7 @@ gather (const MPI_Datatype mpi_data_t,
     }
   }
   for (auto& [pid,data] : send_pid2data) {
+    if (pid==me) continue;
     auto& req = send_req.emplace_back();
     check_mpi_call(MPI_Isend (data.data(),data.size(),mpi_data_t,pid,tag,mpi_comm,&req),
                    "GridImportExport::gather, creating send request (step 3)");
@@ -347,6 +383,7 @@ gather (const MPI_Datatype mpi_data_t,
     data.resize(n);
   }
   for (auto& [pid,data] : recv_pid2data) {
+    if (pid==me) continue;
     auto& req = recv_req.emplace_back();
     check_mpi_call(MPI_Irecv (data.data(),data.size(),mpi_data_t,pid,tag,mpi_comm,&req),
                    "GridImportExport::gather, creating recv request (step 3)");
@@ -357,6 +394,7 @@ gather (const MPI_Datatype mpi_data_t,
                  "GridImportExport::gather, waiting on recv requests (step 3)");
   send_req.clear();
   recv_req.clear();
+  copy_self(recv_pid2data,send_pid2data);
 
   // 4. Unpack received data in dst map
   const auto& recv_gid2lid = m_unique->get_gid2lid_map();
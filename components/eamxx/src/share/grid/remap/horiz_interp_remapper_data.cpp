@@ -4,12 +4,73 @@
 #include "share/grid/grid_import_export.hpp"
 #include "share/io/eamxx_scorpio_interface.hpp"
 
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
 #include <numeric>
 
 namespace scream {
 
+namespace {
+
+// FNV-1a hash, used to fingerprint the map file and the fine grid decomposition
+constexpr std::uint64_t fnv_offset = 14695981039346656037ULL;
+constexpr std::uint64_t fnv_prime  = 1099511628211ULL;
+
+std::uint64_t fnv1a (const void* data, const std::size_t nbytes,
+                     std::uint64_t h = fnv_offset)
+{
+  auto bytes = reinterpret_cast<const unsigned char*>(data);
+  for (std::size_t i=0; i<nbytes; ++i) {
+    h = (h ^ bytes[i]) * fnv_prime;
+  }
+  return h;
+}
+
+// Hash of the map file content. Computed on root, and broadcast.
+std::uint64_t map_file_hash (const std::string& map_file, const ekat::Comm& comm)
+{
+  std::uint64_t h = fnv_offset;
+  if (comm.am_i_root()) {
+    std::ifstream ifs(map_file,std::ios::binary);
+    EKAT_REQUIRE_MSG (ifs.good(),
+        "Error! Could not open map file.\n"
+        " - map file: " + map_file + "\n");
+    std::vector<char> buf(1 << 20);
+    while (ifs) {
+      ifs.read(buf.data(),buf.size());
+      h = fnv1a(buf.data(),ifs.gcount(),h);
+    }
+  }
+  MPI_Bcast(&h,1,MPI_UINT64_T,comm.root_rank(),comm.mpi_comm());
+  return h;
+}
+
+struct CacheHeader {
+  char          magic[8];
+  std::int32_t  version;
+  std::int32_t  sizeof_real;
+  std::int32_t  type;
+  std::int32_t  nranks;
+  std::int32_t  rank;
+  std::int32_t  pad;
+  std::uint64_t map_hash;
+  std::uint64_t decomp_hash;
+  std::int64_t  num_ov_gids;
+  std::int64_t  num_gids;
+  std::int64_t  num_rows;
+  std::int64_t  nnz;
+};
+constexpr char cache_magic[8] = {'E','X','X','H','R','M','A','P'};
+constexpr int cache_version = 1;
+
+} // anonymous namespace
+
 // --------------- HorizRemapperData ---------------- //
 
+std::string HorizRemapperData::s_cache_dir = "";
+
 void HorizRemapperData::
 build (const std::string& map_file,
        const std::shared_ptr<const AbstractGrid>& fine_grid_in,
@@ -19,6 +80,25 @@ build (const std::string& map_file,
   comm = comm_in;
   fine_grid = fine_grid_in;
   type = type_in;
+  loaded_from_cache = false;
+
+  // If caching is on, try to load the data built in a previous run.
+  // Loading is all-or-nothing, since building the data is a collective operation
+  const bool use_cache = not s_cache_dir.empty();
+  std::uint64_t map_hash = 0;
+  std::string cache_file;
+  if (use_cache) {
+    map_hash = map_file_hash(map_file,comm);
+    cache_file = cache_file_name(map_file);
+    std::vector<gid_type> ov_gids, gids;
+    int loaded = load_cache(cache_file,map_hash,ov_gids,gids);
+    comm.all_reduce(&loaded,1,MPI_MIN);
+    if (loaded==1) {
+      create_coarse_grids(ov_gids,gids);
+      loaded_from_cache = true;
+      return;
+    }
+  }
 
   // Gather sparse matrix triplets needed by this rank
   auto my_triplets = get_my_triplets (map_file);
@@ -28,6 +108,10 @@ build (const std::string& map_file,
 
   // Create crs matrix
   create_crs_matrix_structures (my_triplets);
+
+  if (use_cache) {
+    save_cache(cache_file,map_hash);
+  }
 }
 
 auto HorizRemapperData::
@@ -90,8 +174,9 @@ get_my_triplets (const std::string& map_file) const
 
   // Create a grid based on the row gids I read in (may be duplicated across ranks)
   const auto& gids = type==InterpType::Refine ? rows : cols;
-  std::set<gid_type> temp (gids.begin(),gids.end());
-  std::vector<gid_type> unique_gids (temp.begin(),temp.end());
+  std::vector<gid_type> unique_gids (gids.begin(),gids.end());
+  std::sort(unique_gids.begin(),unique_gids.end());
+  unique_gids.erase(std::unique(unique_gids.begin(),unique_gids.end()),unique_gids.end());
   auto io_grid = std::make_shared<PointGrid> ("helper",unique_gids.size(),0,comm);
   auto io_grid_gids_h = io_grid->get_dofs_gids().get_view<gid_type*,Host>();
   int k = 0;
@@ -100,12 +185,12 @@ get_my_triplets (const std::string& map_file) const
   }
   io_grid->get_dofs_gids().sync_to_dev();
 
-  // Create Triplets to export, sorted by gid
+  // Create Triplets to export, sorted by gid. Since io grid gids are sorted,
+  // the lid of a gid is simply its position in unique_gids
   std::map<int,std::vector<Triplet>> io_triplets;
-  const auto& io_grid_gid2lid = io_grid->get_gid2lid_map();
   for (int i=0; i<nlweights; ++i) {
     auto gid = gids[i];
-    auto io_lid = io_grid_gid2lid.at(gid);
+    auto io_lid = std::lower_bound(unique_gids.begin(),unique_gids.end(),gid) - unique_gids.begin();
     io_triplets[io_lid].emplace_back(rows[i], cols[i], S[i]);
   }
 
@@ -145,25 +230,21 @@ get_my_triplets (const std::string& map_file) const
 void HorizRemapperData::
 create_coarse_grids (const std::vector<Triplet>& triplets)
 {
-  // Gather overlapped coarse grid gids (rows or cols, depending on type)
-  std::map<gid_type,int> ov_gid2lid;
+  // Gather overlapped coarse grid gids (rows or cols, depending on type), sorted
+  std::vector<gid_type> ov_gids;
+  ov_gids.reserve(triplets.size());
   bool pickRow = type==InterpType::Coarsen;
   for (const auto& t : triplets) {
-    ov_gid2lid.emplace(pickRow ? t.row : t.col,ov_gid2lid.size());
+    ov_gids.push_back(pickRow ? t.row : t.col);
   }
-  int num_ov_gids = ov_gid2lid.size();
+  std::sort(ov_gids.begin(),ov_gids.end());
+  ov_gids.erase(std::unique(ov_gids.begin(),ov_gids.end()),ov_gids.end());
 
   // Use a temp and then assing, b/c grid_ptr_type is a pointer to const,
   // so you can't modify gids using that pointer
-  ov_coarse_grid = std::make_shared<PointGrid>("ov_coarse_grid",num_ov_gids,0,comm);
+  ov_coarse_grid = std::make_shared<PointGrid>("ov_coarse_grid",ov_gids.size(),0,comm);
   auto ov_coarse_gids_h = ov_coarse_grid->get_dofs_gids().get_view<gid_type*,Host>();
-  for (const auto& it : ov_gid2lid) {
-    ov_coarse_gids_h[it.second] = it.first;
-  }
-  auto beg = ov_coarse_gids_h.data();
-  auto end = beg+ov_coarse_gids_h.size();
-  std::sort(beg,end);
-
+  std::copy(ov_gids.begin(),ov_gids.end(),ov_coarse_gids_h.data());
   ov_coarse_grid->get_dofs_gids().sync_to_dev();
 
   // Create the unique coarse grid
@@ -175,6 +256,21 @@ create_coarse_grids (const std::vector<Triplet>& triplets)
   coarse_grid->get_dofs_gids().sync_to_dev();
 }
 
+void HorizRemapperData::
+create_coarse_grids (const std::vector<gid_type>& ov_gids,
+                     const std::vector<gid_type>& gids)
+{
+  ov_coarse_grid = std::make_shared<PointGrid>("ov_coarse_grid",ov_gids.size(),0,comm);
+  auto ov_coarse_gids_h = ov_coarse_grid->get_dofs_gids().get_view<gid_type*,Host>();
+  std::copy(ov_gids.begin(),ov_gids.end(),ov_coarse_gids_h.data());
+  ov_coarse_grid->get_dofs_gids().sync_to_dev();
+
+  coarse_grid = std::make_shared<PointGrid>("coarse_grid",gids.size(),0,comm);
+  auto coarse_gids_h = coarse_grid->get_dofs_gids().get_view<gid_type*,Host>();
+  std::copy(gids.begin(),gids.end(),coarse_gids_h.data());
+  coarse_grid->get_dofs_gids().sync_to_dev();
+}
+
 void HorizRemapperData::
 create_crs_matrix_structures (std::vector<Triplet>& triplets)
 {
@@ -189,18 +285,20 @@ create_crs_matrix_structures (std::vector<Triplet>& triplets)
 
   // Sort triplets so that row GIDs appear in the same order as
   // in the row grid. If two row GIDs are the same, use same logic
-  // with col
-  auto compare = [&] (const Triplet& lhs, const Triplet& rhs) {
-    auto lhs_lrow = row_gid2lid.at(lhs.row);
-    auto rhs_lrow = row_gid2lid.at(rhs.row);
-    auto lhs_lcol = col_gid2lid.at(lhs.col);
-    auto rhs_lcol = col_gid2lid.at(rhs.col);
-    return lhs_lrow<rhs_lrow or (lhs_lrow==rhs_lrow and lhs_lcol<rhs_lcol);
-  };
-  std::sort(triplets.begin(),triplets.end(),compare);
+  // with col. Lids are looked up once, rather than at every comparison.
+  const int nnz = triplets.size();
+  std::vector<std::pair<int,int>> lids(nnz);
+  for (int i=0; i<nnz; ++i) {
+    lids[i].first  = row_gid2lid.at(triplets[i].row);
+    lids[i].second = col_gid2lid.at(triplets[i].col);
+  }
+  std::vector<int> perm(nnz);
+  std::iota(perm.begin(),perm.end(),0);
+  std::sort(perm.begin(),perm.end(),[&](const int lhs, const int rhs) {
+    return lids[lhs]<lids[rhs];
+  });
 
   // Alloc views and create mirror views
-  const int nnz = triplets.size();
   row_offsets = view_1d<int>("",num_rows+1);
   col_lids    = view_1d<int>("",nnz);
   weights     = view_1d<Real>("",nnz);
@@ -211,8 +309,8 @@ create_crs_matrix_structures (std::vector<Triplet>& triplets)
 
   // Fill col ids and weights
   for (int i=0; i<nnz; ++i) {
-    col_lids_h(i) = col_gid2lid.at(triplets[i].col);
-    weights_h(i)  = triplets[i].w;
+    col_lids_h(i) = lids[perm[i]].second;
+    weights_h(i)  = triplets[perm[i]].w;
   }
   Kokkos::deep_copy(weights,weights_h);
   Kokkos::deep_copy(col_lids,col_lids_h);
@@ -220,7 +318,7 @@ create_crs_matrix_structures (std::vector<Triplet>& triplets)
   // Compute row offsets
   std::vector<int> row_counts(num_rows);
   for (int i=0; i<nnz; ++i) {
-    ++row_counts[row_gid2lid.at(triplets[i].row)];
+    ++row_counts[lids[i].first];
   }
   std::partial_sum(row_counts.begin(),row_counts.end(),row_offsets_h.data()+1);
   EKAT_REQUIRE_MSG (
@@ -232,4 +330,131 @@ create_crs_matrix_structures (std::vector<Triplet>& triplets)
   Kokkos::deep_copy(row_offsets,row_offsets_h);
 }
 
+std::string HorizRemapperData::
+cache_file_name (const std::string& map_file) const
+{
+  auto basename = map_file.substr(map_file.find_last_of('/')+1);
+  return s_cache_dir + "/" + basename
+       + (type==InterpType::Refine ? ".refine" : ".coarsen")
+       + ".np" + std::to_string(comm.size())
+       + "." + std::to_string(comm.rank()) + ".crs";
+}
+
+namespace {
+
+std::uint64_t decomp_hash (const AbstractGrid& grid)
+{
+  auto gids_h = grid.get_dofs_gids().get_view<const AbstractGrid::gid_type*,Host>();
+  return fnv1a(gids_h.data(),gids_h.size()*sizeof(AbstractGrid::gid_type));
+}
+
+template<typename T>
+bool read_array (std::ifstream& ifs, T* data, const std::int64_t n)
+{
+  ifs.read(reinterpret_cast<char*>(data),n*sizeof(T));
+  return ifs.good();
+}
+
+template<typename T>
+void write_array (std::ofstream& ofs, const T* data, const std::int64_t n)
+{
+  ofs.write(reinterpret_cast<const char*>(data),n*sizeof(T));
+}
+
+} // anonymous namespace
+
+bool HorizRemapperData::
+load_cache (const std::string& cache_file, const std::uint64_t map_hash,
+            std::vector<gid_type>& ov_gids, std::vector<gid_type>& gids)
+{
+  std::ifstream ifs(cache_file,std::ios::binary);
+  if (not ifs.good()) {
+    return false;
+  }
+
+  CacheHeader h;
+  ifs.read(reinterpret_cast<char*>(&h),sizeof(CacheHeader));
+  const bool refine = type==InterpType::Refine;
+  const int num_rows = refine ? fine_grid->get_num_local_dofs() : -1;
+  if (not ifs.good() or
+      std::memcmp(h.magic,cache_magic,8)!=0 or
+      h.version!=cache_version or
+      h.sizeof_real!=sizeof(Real) or
+      h.type!=static_cast<int>(type) or
+      h.nranks!=comm.size() or
+      h.rank!=comm.rank() or
+      h.map_hash!=map_hash or
+      h.decomp_hash!=decomp_hash(*fine_grid) or
+      (refine and h.num_rows!=num_rows)) {
+    return false;
+  }
+
+  ov_gids.resize(h.num_ov_gids);
+  gids.resize(h.num_gids);
+  row_offsets = view_1d<int>("",h.num_rows+1);
+  col_lids    = view_1d<int>("",h.nnz);
+  weights     = view_1d<Real>("",h.nnz);
+  auto row_offsets_h = Kokkos::create_mirror_view(row_offsets);
+  auto col_lids_h    = Kokkos::create_mirror_view(col_lids);
+  auto weights_h     = Kokkos::create_mirror_view(weights);
+  if (not read_array(ifs,ov_gids.data(),h.num_ov_gids) or
+      not read_array(ifs,gids.data(),h.num_gids) or
+      not read_array(ifs,row_offsets_h.data(),h.num_rows+1) or
+      not read_array(ifs,col_lids_h.data(),h.nnz) or
+      not read_array(ifs,weights_h.data(),h.nnz)) {
+    return false;
+  }
+  Kokkos::deep_copy(row_offsets,row_offsets_h);
+  Kokkos::deep_copy(col_lids,col_lids_h);
+  Kokkos::deep_copy(weights,weights_h);
+  return true;
+}
+
+void HorizRemapperData::
+save_cache (const std::string& cache_file, const std::uint64_t map_hash) const
+{
+  auto ov_gids_h = ov_coarse_grid->get_dofs_gids().get_view<const gid_type*,Host>();
+  auto gids_h    = coarse_grid->get_dofs_gids().get_view<const gid_type*,Host>();
+  auto row_offsets_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),row_offsets);
+  auto col_lids_h    = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),col_lids);
+  auto weights_h     = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),weights);
+
+  CacheHeader h;
+  std::memset(&h,0,sizeof(CacheHeader));
+  std::memcpy(h.magic,cache_magic,8);
+  h.version     = cache_version;
+  h.sizeof_real = sizeof(Real);
+  h.type        = static_cast<int>(type);
+  h.nranks      = comm.size();
+  h.rank        = comm.rank();
+  h.map_hash    = map_hash;
+  h.decomp_hash = decomp_hash(*fine_grid);
+  h.num_ov_gids = ov_gids_h.size();
+  h.num_gids    = gids_h.size();
+  h.num_rows    = row_offsets_h.size()-1;
+  h.nnz         = col_lids_h.size();
+
+  // Write to a temp file and rename it, so that an interrupted run
+  // cannot leave a truncated cache file behind. The cache is an optimization,
+  // so failing to write it is not an error.
+  const auto tmp_file = cache_file + ".tmp";
+  {
+    std::ofstream ofs(tmp_file,std::ios::binary);
+    if (not ofs.good()) {
+      return;
+    }
+    ofs.write(reinterpret_cast<const char*>(&h),sizeof(CacheHeader));
+    write_array(ofs,ov_gids_h.data(),h.num_ov_gids);
+    write_array(ofs,gids_h.data(),h.num_gids);
+    write_array(ofs,row_offsets_h.data(),h.num_rows+1);
+    write_array(ofs,col_lids_h.data(),h.nnz);
+    write_array(ofs,weights_h.data(),h.nnz);
+    if (not ofs.good()) {
+      std::remove(tmp_file.c_str());
+      return;
+    }
+  }
+  std::rename(tmp_file.c_str(),cache_file.c_str());
+}
+
 } // namespace scream
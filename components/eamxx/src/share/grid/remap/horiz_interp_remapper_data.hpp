@@ -6,9 +6,11 @@
 
 #include <ekat/mpi/ekat_comm.hpp>
 
+#include <cstdint>
 #include <memory>
 #include <map>
 #include <string>
+#include <vector>
 
 namespace scream {
 
@@ -32,6 +34,12 @@ struct HorizRemapperData {
               const ekat::Comm& comm,
               const InterpType type);
 
+  // If set (non-empty), the CRS matrix data and the coarse grids gids of each rank
+  // are stored in this folder after being built from the map file, and loaded from
+  // there in later runs. A cache file is only used if the map file content and the
+  // fine grid decomposition match those used to create it.
+  static void set_cache_dir (const std::string& dir) { s_cache_dir = dir; }
+
   // The coarse grid data
   std::shared_ptr<AbstractGrid> coarse_grid;
   std::shared_ptr<AbstractGrid> ov_coarse_grid;
@@ -42,6 +50,9 @@ struct HorizRemapperData {
   view_1d<Real>   weights;
 
   int num_customers = 0;
+
+  // Whether the last call to build loaded the data from the cache (same on all ranks)
+  bool loaded_from_cache = false;
 private:
   using gid_type = AbstractGrid::gid_type;
 
@@ -64,10 +75,21 @@ private:
   get_my_triplets (const std::string& map_file) const;
 
   void create_coarse_grids (const std::vector<Triplet>& triplets);
+  void create_coarse_grids (const std::vector<gid_type>& ov_gids,
+                            const std::vector<gid_type>& gids);
 
   // Not a const ref, since we'll sort the triplets according to
   // how row gids appear in the coarse grid
   void create_crs_matrix_structures (std::vector<Triplet>& triplets);
+
+  // Cache file for this rank. Loading only reads the data: the coarse grids
+  // are created (collectively) once all ranks could load their cache.
+  std::string cache_file_name (const std::string& map_file) const;
+  bool load_cache (const std::string& cache_file, const std::uint64_t map_hash,
+                   std::vector<gid_type>& ov_gids, std::vector<gid_type>& gids);
+  void save_cache (const std::string& cache_file, const std::uint64_t map_hash) const;
+
+  static std::string s_cache_dir;
 };
 
 } // namespace scream
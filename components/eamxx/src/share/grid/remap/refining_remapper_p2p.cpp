@@ -29,16 +29,18 @@ RefiningRemapperP2P::
 
 void RefiningRemapperP2P::remap_fwd_impl ()
 {
-  // Fire the recv requests right away, so that if some other ranks
-  // is done packing before us, we can start receiving their data
-  if (not m_recv_req.empty()) {
-    check_mpi_call(MPI_Startall(m_recv_req.size(),m_recv_req.data()),
-                   "[RefiningRemapperP2P] starting persistent recv requests.\n");
-  }
+  if (not m_src_on_ov_grid) {
+    // Fire the recv requests right away, so that if some other ranks
+    // is done packing before us, we can start receiving their data
+    if (not m_recv_req.empty()) {
+      check_mpi_call(MPI_Startall(m_recv_req.size(),m_recv_req.data()),
+                     "[RefiningRemapperP2P] starting persistent recv requests.\n");
+    }
 
-  // Do P2P communications
-  pack_and_send ();
-  recv_and_unpack ();
+    // Do P2P communications
+    pack_and_send ();
+    recv_and_unpack ();
+  }
 
   // Perform local-mat vec
   // Helpef function, to establish if a field can be handled with packs
@@ -78,7 +80,7 @@ void RefiningRemapperP2P::remap_fwd_impl ()
   }
 
   // Wait for all sends to be completed
-  if (not m_send_req.empty()) {
+  if (not m_src_on_ov_grid and not m_send_req.empty()) {
     check_mpi_call(MPI_Waitall(m_send_req.size(),m_send_req.data(), MPI_STATUSES_IGNORE),
                    "[RefiningRemapperP2P] waiting on persistent send requests.\n");
   }
@@ -147,9 +149,23 @@ void RefiningRemapperP2P::setup_mpi_data_structures ()
 
   // ----------- Create Requests ------------ //
 
+  // Cols that stay on this rank are not sent via MPI: in recv_and_unpack,
+  // the corresponding portion of the send buffer is copied in the recv buffer.
+  const int me = m_comm.rank();
+  EKAT_REQUIRE_MSG (ncols_send_h(me)==ncols_recv_h(me),
+      "Error! Mismatch between number of cols exported to and imported from this rank.\n"
+      " - num exports: " + std::to_string(ncols_send_h(me)) + "\n"
+      " - num imports: " + std::to_string(ncols_recv_h(me)) + "\n");
+  m_self_send_range.first  = pids_send_offsets_h(me)*total_col_size;
+  m_self_send_range.second = pids_send_offsets_h(me+1)*total_col_size;
+  m_self_recv_range.first  = pids_recv_offsets_h(me)*total_col_size;
+  m_self_recv_range.second = pids_recv_offsets_h(me+1)*total_col_size;
+
   const auto mpi_comm = m_comm.mpi_comm();
   const auto mpi_real = ekat::get_mpi_type<Real>();
   for (int pid=0; pid<nranks; ++pid) {
+    if (pid==me) continue;
+
     // Send request
     if (ncols_send_h(pid)>0) {
       auto send_ptr = m_mpi_send_buffer.data() + pids_send_offsets_h(pid)*total_col_size;
@@ -318,6 +334,11 @@ void RefiningRemapperP2P::recv_and_unpack ()
   if (not MpiOnDev) {
     Kokkos::deep_copy (m_recv_buffer,m_mpi_recv_buffer);
   }
+  // Cols that stay on this rank are copied directly from the send buffer
+  if (m_self_send_range.second>m_self_send_range.first) {
+    Kokkos::deep_copy (Kokkos::subview(m_recv_buffer,m_self_recv_range),
+                       Kokkos::subview(m_send_buffer,m_self_send_range));
+  }
 
   using RangePolicy = typename KT::RangePolicy;
   using TeamMember  = typename KT::MemberType;
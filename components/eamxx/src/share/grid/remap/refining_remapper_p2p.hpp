@@ -55,6 +55,16 @@ public:
 
   ~RefiningRemapperP2P ();
 
+  // By default, the user fills the src fields (on the unique src grid), and
+  // remap_fwd redistributes them to the overlapped src grid before the local
+  // mat-vec. If the user can fill the overlapped src fields directly (e.g.,
+  // reading from file only the src cols needed by this rank), the MPI
+  // redistribution can be skipped altogether.
+  // NOTE: only fields with the COL dimension have an overlapped version
+  void set_src_on_ov_grid (const bool on_ov_grid) { m_src_on_ov_grid = on_ov_grid; }
+  grid_ptr_type get_ov_src_grid () const { return m_ov_coarse_grid; }
+  const Field& get_ov_src_field (const int i) const { return m_ov_fields.at(i); }
+
 protected:
 
   void remap_fwd_impl () override;
@@ -104,6 +114,10 @@ protected:
   view_1d<int>  m_pids_send_offsets;
   view_1d<int>  m_pids_recv_offsets;
 
+  // Range of this rank's own cols in send/recv buffers (these are not sent via MPI)
+  Kokkos::pair<int,int> m_self_send_range;
+  Kokkos::pair<int,int> m_self_recv_range;
+
   // For each col, its position within the set of cols
   // sent/recv to/from the corresponding remote
   view_1d<int>  m_send_col_pos;
@@ -112,6 +126,9 @@ protected:
   // Send/recv persistent requests
   std::vector<MPI_Request>  m_send_req;
   std::vector<MPI_Request>  m_recv_req;
+
+  // Whether the user fills the overlapped src fields directly
+  bool m_src_on_ov_grid = false;
 };
 
 } // namespace scream
@@ -0,0 +1,84 @@
+#include "share/io/eamxx_output_diag_registry.hpp"
+
+namespace scream
+{
+
+bool OutputDiagRegistry::
+has_diag (const std::string& name, const std::string& grid_name) const
+{
+  return m_diags.count(key_type(name,grid_name))==1;
+}
+
+auto OutputDiagRegistry::
+get_diag (const std::string& name, const std::string& grid_name) const
+ -> diag_ptr_type
+{
+  auto it = m_diags.find(key_type(name,grid_name));
+  EKAT_REQUIRE_MSG (it!=m_diags.end(),
+      "Error! Diagnostic not found in the output diag registry.\n"
+      " - diag name: " + name + "\n"
+      " - grid name: " + grid_name + "\n");
+  return it->second;
+}
+
+void OutputDiagRegistry::
+add_diag (const std::string& name, const std::string& grid_name,
+          const diag_ptr_type& diag)
+{
+  EKAT_REQUIRE_MSG (diag!=nullptr,
+      "Error! Invalid diagnostic pointer.\n"
+      " - diag name: " + name + "\n"
+      " - grid name: " + grid_name + "\n");
+  EKAT_REQUIRE_MSG (not has_diag(name,grid_name),
+      "Error! Diagnostic was already added to the output diag registry.\n"
+      " - diag name: " + name + "\n"
+      " - grid name: " + grid_name + "\n");
+  m_diags[key_type(name,grid_name)] = diag;
+}
+
+bool OutputDiagRegistry::
+is_up_to_date (const diag_ptr_type& diag) const
+{
+  auto it = m_last_computed.find(diag.get());
+  if (it==m_last_computed.end()) {
+    return false;
+  }
+
+  // If the diag "refused" to compute (invalid time stamp), we must try again
+  const auto& d = diag->get_diagnostic();
+  if (not d.get_header().get_tracking().get_time_stamp().is_valid()) {
+    return false;
+  }
+
+  const auto ts = inputs_time_stamp(diag);
+  return ts.is_valid() and ts==it->second;
+}
+
+void OutputDiagRegistry::
+mark_computed (const diag_ptr_type& diag)
+{
+  m_last_computed[diag.get()] = inputs_time_stamp(diag);
+}
+
+void OutputDiagRegistry::clear ()
+{
+  m_diags.clear();
+  m_last_computed.clear();
+}
+
+util::TimeStamp OutputDiagRegistry::
+inputs_time_stamp (const diag_ptr_type& diag)
+{
+  // Same as the time stamp that AtmosphereDiagnostic::compute_diagnostic
+  // assigns to the diag: the most recent among the inputs
+  util::TimeStamp ts;
+  for (const auto& f : diag->get_fields_in()) {
+    const auto& fts = f.get_header().get_tracking().get_time_stamp();
+    if (not ts.is_valid() || ts<fts) {
+      ts = fts;
+    }
+  }
+  return ts;
+}
+
+} // namespace scream
@@ -0,0 +1,60 @@
+#ifndef SCREAM_OUTPUT_DIAG_REGISTRY_HPP
+#define SCREAM_OUTPUT_DIAG_REGISTRY_HPP
+
+#include "share/atm_process/atmosphere_diagnostic.hpp"
+#include "share/util/eamxx_time_stamp.hpp"
+
+#include <map>
+#include <memory>
+#include <string>
+
+namespace scream
+{
+
+/*
+ * A registry of the diagnostics created by output streams
+ *
+ * The same diagnostic is often requested by several output streams (e.g.,
+ * a daily, a monthly, and a high-frequency stream). Output streams that
+ * share a registry create each diagnostic (identified by its name and grid)
+ * only once, share its output field, and evaluate it at most once for
+ * each time stamp of its inputs.
+ *
+ * The AD creates one registry, and hands it to all its OutputManager's.
+ */
+
+class OutputDiagRegistry
+{
+public:
+  using diag_ptr_type = std::shared_ptr<AtmosphereDiagnostic>;
+
+  bool has_diag (const std::string& name, const std::string& grid_name) const;
+
+  diag_ptr_type get_diag (const std::string& name, const std::string& grid_name) const;
+
+  void add_diag (const std::string& name, const std::string& grid_name,
+                 const diag_ptr_type& diag);
+
+  // Whether the diag was already computed for the current time stamp of its inputs.
+  bool is_up_to_date (const diag_ptr_type& diag) const;
+
+  // Record that the diag was computed for the current time stamp of its inputs
+  void mark_computed (const diag_ptr_type& diag);
+
+  int num_diags () const { return m_diags.size(); }
+
+  void clear ();
+
+protected:
+
+  static util::TimeStamp inputs_time_stamp (const diag_ptr_type& diag);
+
+  using key_type = std::pair<std::string,std::string>;
+
+  std::map<key_type,diag_ptr_type>                        m_diags;
+  std::map<const AtmosphereDiagnostic*,util::TimeStamp>   m_last_computed;
+};
+
+} // namespace scream
+
+#endif // SCREAM_OUTPUT_DIAG_REGISTRY_HPP
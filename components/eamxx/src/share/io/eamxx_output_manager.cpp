@@ -62,6 +62,11 @@ setup (const std::shared_ptr<fm_type>& field_mgr,
     return;
   }
 
+  // If not shared with other managers, diags are still shared across this manager's streams
+  if (m_diag_registry==nullptr) {
+    m_diag_registry = std::make_shared<OutputDiagRegistry>();
+  }
+
   // Here, store if PG2 fields will be present in output streams.
   // Will be useful if multiple grids are defined (see below).
   bool pg2_grid_in_io_streams = false;
@@ -82,7 +87,7 @@ setup (const std::shared_ptr<fm_type>& field_mgr,
     EKAT_REQUIRE_MSG(grid_names.size()==1,
       "Error! Output requested on multiple grids but no grid information exists in output params.\n");
 
-    auto output = std::make_shared<output_type>(m_io_comm,m_params,field_mgr,*grid_names.begin());
+    auto output = std::make_shared<output_type>(m_io_comm,m_params,field_mgr,*grid_names.begin(),m_diag_registry);
     output->set_logger(m_atm_logger);
     m_output_streams.push_back(output);
   } else {
@@ -116,7 +121,7 @@ setup (const std::shared_ptr<fm_type>& field_mgr,
       // as this is what the FieldManager expects.
       const auto& gname = field_mgr->get_grids_manager()->get_grid(*it)->name();
 
-      auto output = std::make_shared<output_type>(m_io_comm,m_params,field_mgr,gname);
+      auto output = std::make_shared<output_type>(m_io_comm,m_params,field_mgr,gname,m_diag_registry);
       output->set_logger(m_atm_logger);
       m_output_streams.push_back(output);
     }
@@ -466,8 +471,13 @@ void OutputManager::run(const util::TimeStamp& timestamp)
   if (is_output_step) {
     setup_output_file(m_output_control,m_output_file_specs);
 
-    // Update time (must be done _before_ writing fields)
-    update_time(m_output_file_specs.filename,timestamp.days_from(m_case_t0));
+    if (m_time_series_chunk>0) {
+      // Time is updated once per chunk, right before the chunk is written
+      m_time_series_times.push_back(timestamp.days_from(m_case_t0));
+    } else {
+      // Update time (must be done _before_ writing fields)
+      update_time(m_output_file_specs.filename,timestamp.days_from(m_case_t0));
+    }
   }
   if (is_checkpoint_step) {
     setup_output_file(m_checkpoint_control,m_checkpoint_file_specs);
@@ -562,6 +572,11 @@ void OutputManager::run(const util::TimeStamp& timestamp)
       // We're adding one snapshot to the file
       filespecs.storage.update_storage(timestamp);
 
+      if (m_time_series_chunk>0 and &filespecs==&m_output_file_specs and
+          static_cast<int>(m_time_series_times.size())==m_time_series_chunk) {
+        write_time_series_chunk(filespecs);
+      }
+
       // NOTE: for checkpoint files, unless we write restart data, we did not update time,
       //       which means we cannot write any variable (the check var.num_records==time.length
       //       would fail)
@@ -583,8 +598,10 @@ void OutputManager::run(const util::TimeStamp& timestamp)
     if (is_checkpoint_step) {
       write_global_data(m_checkpoint_control,m_checkpoint_file_specs);
 
-      // Always flush output during checkpoints (assuming we opened it already)
+      // Always flush output during checkpoints (assuming we opened it already),
+      // including a partial time-series chunk, so that it survives a restart
       if (m_output_file_specs.is_open) {
+        write_time_series_chunk(m_output_file_specs);
         scorpio::flush_file (m_output_file_specs.filename);
       }
     }
@@ -602,6 +619,7 @@ void OutputManager::finalize()
 {
   // Close any output file still open
   if (m_output_file_specs.is_open) {
+    write_time_series_chunk(m_output_file_specs);
     scorpio::release_file (m_output_file_specs.filename);
   }
   if (m_checkpoint_file_specs.is_open) {
@@ -619,6 +637,7 @@ void OutputManager::finalize()
   m_params  = {};
   m_filename_prefix = {};
   m_time_bnds = {};
+  m_time_series_times = {};
   m_avg_type = {};
   m_output_control = {};
   m_checkpoint_control = {};
@@ -741,6 +760,12 @@ setup_internals (const std::shared_ptr<fm_type>& field_mgr,
         "Error! Invalid/unsupported value for 'floating_point_precision'.\n"
         "  - input value: " + prec + "\n"
         "  - supported values: float, single, double, real\n");
+
+    // Time-series output (the streams check that the value is valid)
+    m_time_series_chunk = m_params.get<int>("time_series_chunk_size",0);
+    if (m_params.isParameter("fill_value")) {
+      m_fill_value = static_cast<float>(m_params.get<double>("fill_value"));
+    }
   }
 
   // Output control
@@ -846,6 +871,14 @@ setup_file (      IOFileSpecs& filespecs,
       scorpio::set_attribute<std::string> (filename,"time","bounds","time_bnds");
     }
 
+    if (m_time_series_chunk>0) {
+      // Each time record holds a chunk of snapshots, and 'time' is the time of the last one
+      scorpio::define_dim(filename,"time_in_chunk",m_time_series_chunk);
+      scorpio::define_var(filename,"time_series_time",time_units,{"time_in_chunk"},"double","double",true);
+      scorpio::set_attribute(filename,"time_series_time","_FillValue",static_cast<double>(m_fill_value));
+      scorpio::set_attribute<std::string> (filename,"time","note","time of the last snapshot in the chunk");
+    }
+
     write_timestamp(filename,"case_t0",m_case_t0);
     write_timestamp(filename,"run_t0",m_run_t0);
     scorpio::set_attribute(filename,"GLOBAL","averaging_type",e2str(m_avg_type));
@@ -919,9 +952,13 @@ void OutputManager::set_file_header(const IOFileSpecs& file_specs)
 }
 void OutputManager::
 close_or_flush_if_needed (      IOFileSpecs& file_specs,
-                          const IOControl&   control) const
+                          const IOControl&   control)
 {
   if (not file_specs.storage.snapshot_fits(control.next_write_ts)) {
+    if (&file_specs==&m_output_file_specs) {
+      // Don't lose the last (partial) time-series chunk
+      write_time_series_chunk(file_specs);
+    }
     scorpio::release_file(file_specs.filename);
     file_specs.close();
   } else if (file_specs.file_needs_flush()) {
@@ -929,6 +966,28 @@ close_or_flush_if_needed (      IOFileSpecs& file_specs,
   }
 }
 
+void OutputManager::
+write_time_series_chunk (const IOFileSpecs& file_specs)
+{
+  if (m_time_series_times.empty()) {
+    return;
+  }
+
+  const auto& filename = file_specs.filename;
+
+  // Update time (must be done _before_ writing fields)
+  scorpio::update_time(filename,m_time_series_times.back());
+
+  // Pad a partial chunk with fill value
+  m_time_series_times.resize(m_time_series_chunk,m_fill_value);
+  scorpio::write_var(filename,"time_series_time",m_time_series_times.data());
+  for (auto& it : m_output_streams) {
+    it->write_time_series_chunk(filename);
+  }
+
+  m_time_series_times.clear();
+}
+
 void OutputManager::
 push_to_logger()
 {
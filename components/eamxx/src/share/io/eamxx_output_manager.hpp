@@ -106,6 +106,11 @@ public:
   void set_logger(const std::shared_ptr<ekat::logger::LoggerBase>& atm_logger) {
       m_atm_logger = atm_logger;
   }
+  // If set (before calling setup), diagnostics are shared with all other
+  // output managers that use the same registry
+  void set_diag_registry (const std::shared_ptr<OutputDiagRegistry>& diag_registry) {
+      m_diag_registry = diag_registry;
+  }
   void add_global (const std::string& name, const ekat::any& global);
 
   void init_timestep (const util::TimeStamp& start_of_step, const Real dt);
@@ -136,7 +141,10 @@ protected:
 
   // If a file can be closed (next snap won't fit) or needs flushing, do so
   void close_or_flush_if_needed (      IOFileSpecs& file_specs,
-                                 const IOControl&   control) const;
+                                 const IOControl&   control);
+
+  // For time-series output, write the snapshots buffered so far as one time record
+  void write_time_series_chunk (const IOFileSpecs& file_specs);
 
   // Manage logging of info to atm.log
   void push_to_logger();
@@ -157,6 +165,11 @@ protected:
 
   std::vector<double> m_time_bnds;
 
+  // For time-series output (time_series_chunk_size>0), the times of the buffered snapshots
+  int                 m_time_series_chunk = 0;
+  std::vector<double> m_time_series_times;
+  float               m_fill_value = constants::DefaultFillValue<float>().value;
+
   // How to combine multiple snapshots in the output: instant, Max, Min, Average
   OutputAvgType     m_avg_type;
 
@@ -189,6 +202,9 @@ protected:
   // The logger to be used throughout the ATM to log message
   std::shared_ptr<ekat::logger::LoggerBase> m_atm_logger;
 
+  // Registry of the diagnostics, possibly shared with other output managers
+  std::shared_ptr<OutputDiagRegistry> m_diag_registry;
+
   // If true, we save grid data in output file
   bool m_save_grid_data;
 };
@@ -9,6 +9,8 @@
 #include <pio.h>
 
 #include <numeric>
+#include <sstream>
+#include <cstdint>
 
 namespace scream {
 namespace scorpio {
@@ -766,11 +768,16 @@ void set_var_decomp (PIOVar& var,
       " - varname   : " + var.name  + "\n"
       " - var decomp: " + var.decomp->name  + "\n");
 
-  // Create decomp name: dtype-dim1<len1>_dim2<len2>_..._dimk<lenN>
+  // Create decomp name: dtype-dim1<len1>@hash_dim2<len2>_..._dimk<lenN>, where hash
+  // identifies the distribution of the decomposed dim (dim1) across ranks
   std::shared_ptr<const PIODim> decomp_dim;
   std::string decomp_tag = var.dtype + "-";
   for (auto d : var.dims) {
-    decomp_tag += d->name + "<" + std::to_string(d->length) + ">_";
+    decomp_tag += d->name + "<" + std::to_string(d->length) + ">";
+    if (d->offsets!=nullptr) {
+      decomp_tag += "@" + d->offsets_hash;
+    }
+    decomp_tag += "_";
   }
   decomp_tag.pop_back(); // remove trailing underscore
 
@@ -899,6 +906,24 @@ void set_dim_decomp (const std::string& filename,
 
   dim.offsets = std::make_shared<std::vector<offset_t>>(my_offsets);
 
+  // Fingerprint the global distribution: FNV-1a hash of (rank,offsets) on each
+  // rank, combined with a XOR across ranks, so that all ranks get the same value
+  const auto& comm = s.comm;
+  std::uint64_t h = 14695981039346656037ULL;
+  auto hash_bytes = [&](const void* data, const std::size_t nbytes) {
+    auto bytes = reinterpret_cast<const unsigned char*>(data);
+    for (std::size_t i=0; i<nbytes; ++i) {
+      h = (h ^ bytes[i]) * 1099511628211ULL;
+    }
+  };
+  const int rank = comm.rank();
+  hash_bytes(&rank,sizeof(int));
+  hash_bytes(my_offsets.data(),my_offsets.size()*sizeof(offset_t));
+  MPI_Allreduce(MPI_IN_PLACE,&h,1,MPI_UINT64_T,MPI_BXOR,comm.mpi_comm());
+  std::ostringstream hash_str;
+  hash_str << std::hex << h;
+  dim.offsets_hash = hash_str.str();
+
   // If vars were already defined, we need to process them,
   // and create the proper PIODecomp objects.
   for (auto it : f.vars) {
@@ -71,6 +71,10 @@ struct PIODim : public PIOFileEntity {
   // NOTE: use a pointer, so we can detect if a decomposition already
   //       existed or not when we set one.
   std::shared_ptr<std::vector<offset_t>> offsets;
+
+  // Fingerprint of the offsets across all ranks. Decomps are shared across files,
+  // so dims with same name/length but different distributions need different decomps
+  std::string offsets_hash;
 };
 
 // A decomposition
@@ -60,8 +60,10 @@ AtmosphereInput (const std::string& filename,
 
 AtmosphereInput::
 AtmosphereInput (const std::vector<std::string>& fields_names,
-                 const std::shared_ptr<const grid_type>& grid)
+                 const std::shared_ptr<const grid_type>& grid,
+                 const bool skip_grid_checks)
 {
+  m_params.set("skip_grid_checks",skip_grid_checks);
   set_grid(grid);
   m_fields_names = fields_names;
 }
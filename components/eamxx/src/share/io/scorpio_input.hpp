@@ -64,7 +64,8 @@ public:
   // This constructor only sets the minimal info, deferring initialization
   // to when set_field_manager/reset_fields and reset_filename are called
   AtmosphereInput (const std::vector<std::string>& fields_names,
-                   const std::shared_ptr<const grid_type>& grid);
+                   const std::shared_ptr<const grid_type>& grid,
+                   const bool skip_grid_checks = false);
 
   // Due to resource acquisition (in scorpio), avoid copies
   AtmosphereInput (const AtmosphereInput&) = delete;
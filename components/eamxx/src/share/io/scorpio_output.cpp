@@ -5,12 +5,14 @@
 #include "share/grid/remap/vertical_remapper.hpp"
 #include "share/util/eamxx_timing.hpp"
 #include "share/field/field_utils.hpp"
+#include "share/field/field_expression.hpp"
 
 #include <ekat/util/ekat_units.hpp>
 #include <ekat/util/ekat_string_utils.hpp>
 #include <ekat/std_meta/ekat_std_utils.hpp>
 
 #include <numeric>
+#include <algorithm>
 
 namespace {
   // Helper lambda, to copy io string attributes. This will be used if any
@@ -63,8 +65,10 @@ AtmosphereOutput (const ekat::Comm& comm,
 AtmosphereOutput::
 AtmosphereOutput (const ekat::Comm& comm, const ekat::ParameterList& params,
                   const std::shared_ptr<const fm_type>& field_mgr,
-                  const std::string& grid_name)
+                  const std::string& grid_name,
+                  const std::shared_ptr<OutputDiagRegistry>& diag_registry)
  : m_comm           (comm)
+ , m_diag_registry  (diag_registry)
  , m_add_time_dim   (true)
 {
   using vos_t = std::vector<std::string>;
@@ -173,67 +177,159 @@ AtmosphereOutput (const ekat::Comm& comm, const ekat::ParameterList& params,
     m_fill_value = static_cast<float>(params.get<double>("fill_value"));
   }
 
-  // Setup remappers - if needed
-  auto grid_after_vr = fm_grid;
-  if (use_vertical_remap_from_file) {
-    // We build a remapper, to remap fields from the fm grid to the io grid
-    auto vert_remap_file   = params.get<std::string>("vertical_remap_file");
-    auto p_mid = fm_model->get_field("p_mid");
-    auto p_int = fm_model->get_field("p_int");
-    auto vert_remapper = std::make_shared<VerticalRemapper>(fm_model->get_grid(),vert_remap_file);
-    vert_remapper->set_source_pressure (p_mid,p_int);
-    vert_remapper->set_mask_value(m_fill_value);
-    vert_remapper->set_extrapolation_type(VerticalRemapper::Mask); // both Top AND Bot
-    m_vert_remapper = vert_remapper;
-
-    grid_after_vr = m_vert_remapper->get_tgt_grid();
-    fm_after_vr = std::make_shared<FieldManager>(grid_after_vr,RepoState::Closed);
-
-    for (const auto& fname : m_fields_names) {
-      auto src = fm_model->get_field(fname,fm_grid->name());
-      auto tgt = m_vert_remapper->register_field_from_src(src);
-      transfer_io_str_atts (src,tgt);
-      fm_after_vr->add_field(tgt);
-    }
-    m_vert_remapper->registration_ends();
-  } else {
-    // No vert remap. Simply alias the fm from the model
-    fm_after_vr = fm_model;
-  }
-
-  // Online remapper and horizontal remapper follow a similar pattern so we check in the same conditional.
-  auto grid_after_hr = grid_after_vr;
-  if (use_online_remapper || use_horiz_remap_from_file) {
-    // We build a remapper, to remap fields from the fm grid to the io grid
-    if (use_horiz_remap_from_file) {
-      // Construct the coarsening remapper
-      auto horiz_remap_file   = params.get<std::string>("horiz_remap_file");
-      m_horiz_remapper = std::make_shared<CoarseningRemapper>(grid_after_vr,horiz_remap_file,true);
+  // Buffer snapshots, and write them in chunks, so that each column's time series is contiguous
+  m_time_series_chunk = params.get<int>("time_series_chunk_size",0);
+  EKAT_REQUIRE_MSG (m_time_series_chunk>=0,
+      "[AtmosphereOutput] Error! Invalid value for 'time_series_chunk_size'.\n"
+      " - input value: " + std::to_string(m_time_series_chunk) + "\n"
+      "Use 0 to disable time-series output, or a positive number of snapshots per chunk.\n");
+  EKAT_REQUIRE_MSG (m_time_series_chunk==0 or m_avg_type==OutputAvgType::Instant,
+      "[AtmosphereOutput] Error! Time-series output is only supported for instant output.\n"
+      " - averaging type: " + avg_type + "\n"
+      " - time_series_chunk_size: " + std::to_string(m_time_series_chunk) + "\n");
+
+  // If both vert and horiz remap are from file, we can either vert remap on the model grid and
+  // coarsen the result ("vert_first", the default) or coarsen first (including p_mid/p_int),
+  // and vert remap on the (smaller) coarse grid ("horiz_first"). The latter is cheaper if the
+  // io grid has far fewer cols, but it is NOT bfb with the former, since the vertical
+  // interpolation is not linear in the pressure. With "auto", we pick the cheapest order.
+  const auto remap_order = params.get<std::string>("remap_order","vert_first");
+  EKAT_REQUIRE_MSG (ekat::contains(strvec_t{"vert_first","horiz_first","auto"},remap_order),
+      "[AtmosphereOutput] Error! Invalid value for 'remap_order'.\n"
+      " - input value: " + remap_order + "\n"
+      " - valid values: vert_first, horiz_first, auto\n");
+  if (use_vertical_remap_from_file and use_horiz_remap_from_file) {
+    if (remap_order=="auto") {
+      m_horiz_remap_first = horiz_remap_first_is_cheaper(params.get<std::string>("vertical_remap_file"),
+                                                         params.get<std::string>("horiz_remap_file"),
+                                                         fm_grid->get_num_vertical_levels());
     } else {
-      // Construct a generic remapper (likely, Dyn->PhysicsGLL)
-      grid_after_hr = gm->get_grid(io_grid_name);
-      m_horiz_remapper = gm->create_remapper(grid_after_vr,grid_after_hr);
+      m_horiz_remap_first = remap_order=="horiz_first";
     }
+  }
+
+  // Setup remappers - if needed
+  if (m_horiz_remap_first) {
+    // Coarsen the output fields, as well as the pressure used as src in the vert remap
+    auto horiz_remap_file = params.get<std::string>("horiz_remap_file");
+    m_horiz_remapper = std::make_shared<CoarseningRemapper>(fm_grid,horiz_remap_file,true);
 
-    grid_after_hr = m_horiz_remapper->get_tgt_grid();
+    auto grid_after_hr = m_horiz_remapper->get_tgt_grid();
     fm_after_hr = std::make_shared<FieldManager>(grid_after_hr,RepoState::Closed);
 
-    for (const auto& fname : m_fields_names) {
-      auto src = fm_after_vr->get_field(fname,grid_after_vr->name());
+    auto hr_fields_names = m_fields_names;
+    for (const std::string pname : {"p_mid","p_int"}) {
+      if (not ekat::contains(hr_fields_names,pname)) {
+        hr_fields_names.push_back(pname);
+      }
+    }
+    for (const auto& fname : hr_fields_names) {
+      auto src = fm_model->get_field(fname,fm_grid->name());
       auto tgt = m_horiz_remapper->register_field_from_src(src);
       transfer_io_str_atts (src,tgt);
       fm_after_hr->add_field(tgt);
     }
     m_horiz_remapper->registration_ends();
+
+    // Now vert remap on the coarse grid
+    setup_vert_remapper(fm_after_hr,params.get<std::string>("vertical_remap_file"));
   } else {
-    // No vert remap. Simply alias the fm after vr
-    fm_after_hr = fm_after_vr;
+    if (use_vertical_remap_from_file) {
+      setup_vert_remapper(fm_model,params.get<std::string>("vertical_remap_file"));
+    } else {
+      // No vert remap. Simply alias the fm from the model
+      fm_after_vr = fm_model;
+    }
+    auto grid_after_vr = fm_after_vr->get_grid();
+
+    // Online remapper and horizontal remapper follow a similar pattern so we check in the same conditional.
+    auto grid_after_hr = grid_after_vr;
+    if (use_online_remapper || use_horiz_remap_from_file) {
+      // We build a remapper, to remap fields from the fm grid to the io grid
+      if (use_horiz_remap_from_file) {
+        // Construct the coarsening remapper
+        auto horiz_remap_file   = params.get<std::string>("horiz_remap_file");
+        m_horiz_remapper = std::make_shared<CoarseningRemapper>(grid_after_vr,horiz_remap_file,true);
+      } else {
+        // Construct a generic remapper (likely, Dyn->PhysicsGLL)
+        grid_after_hr = gm->get_grid(io_grid_name);
+        m_horiz_remapper = gm->create_remapper(grid_after_vr,grid_after_hr);
+      }
+
+      grid_after_hr = m_horiz_remapper->get_tgt_grid();
+      fm_after_hr = std::make_shared<FieldManager>(grid_after_hr,RepoState::Closed);
+
+      for (const auto& fname : m_fields_names) {
+        auto src = fm_after_vr->get_field(fname,grid_after_vr->name());
+        auto tgt = m_horiz_remapper->register_field_from_src(src);
+        transfer_io_str_atts (src,tgt);
+        fm_after_hr->add_field(tgt);
+      }
+      m_horiz_remapper->registration_ends();
+    } else {
+      // No vert remap. Simply alias the fm after vr
+      fm_after_hr = fm_after_vr;
+    }
   }
 
   // Setup I/O structures (including the scorpio FM)
   init ();
 }
 
+/* ---------------------------------------------------------- */
+void AtmosphereOutput::
+setup_vert_remapper (const std::shared_ptr<const FieldManager>& fm_src,
+                     const std::string& vert_remap_file)
+{
+  // Remap fields from the grid of fm_src to the levels in the vert remap file,
+  // using the p_mid/p_int stored in fm_src as source pressure
+  auto grid_src = fm_src->get_grid();
+  auto p_mid = fm_src->get_field("p_mid");
+  auto p_int = fm_src->get_field("p_int");
+  auto vert_remapper = std::make_shared<VerticalRemapper>(grid_src,vert_remap_file);
+  vert_remapper->set_source_pressure (p_mid,p_int);
+  vert_remapper->set_mask_value(m_fill_value);
+  vert_remapper->set_extrapolation_type(VerticalRemapper::Mask); // both Top AND Bot
+  m_vert_remapper = vert_remapper;
+
+  auto grid_after_vr = m_vert_remapper->get_tgt_grid();
+  auto& fm_after_vr = m_field_mgrs[AfterVertRemap];
+  fm_after_vr = std::make_shared<FieldManager>(grid_after_vr,RepoState::Closed);
+
+  for (const auto& fname : m_fields_names) {
+    auto src = fm_src->get_field(fname,grid_src->name());
+    auto tgt = m_vert_remapper->register_field_from_src(src);
+    transfer_io_str_atts (src,tgt);
+    fm_after_vr->add_field(tgt);
+  }
+  m_vert_remapper->registration_ends();
+}
+
+/* ---------------------------------------------------------- */
+bool AtmosphereOutput::
+horiz_remap_first_is_cheaper (const std::string& vert_remap_file,
+                              const std::string& horiz_remap_file,
+                              const int nlevs_src) const
+{
+  scorpio::register_file(vert_remap_file,scorpio::FileMode::Read);
+  const long long nlevs_tgt = scorpio::get_dimlen(vert_remap_file,"lev");
+  scorpio::release_file(vert_remap_file);
+
+  scorpio::register_file(horiz_remap_file,scorpio::FileMode::Read);
+  const long long ncols_src = scorpio::get_dimlen(horiz_remap_file,"n_a");
+  const long long ncols_tgt = scorpio::get_dimlen(horiz_remap_file,"n_b");
+  const long long nnz       = scorpio::get_dimlen(horiz_remap_file,"n_s");
+  scorpio::release_file(horiz_remap_file);
+
+  // Rough count of the points touched by the two remaps, assuming all fields are 3d.
+  // The vert remap costs ~ncols*nlevs_tgt, while the horiz remap costs ~nnz*nlevs.
+  // Coarsening first also requires to coarsen p_mid/p_int.
+  const long long nfields = m_fields_names.size();
+  const auto cost_vert_first  = nfields*(ncols_src + nnz)*nlevs_tgt;
+  const auto cost_horiz_first = (nfields+2)*nnz*nlevs_src + nfields*ncols_tgt*nlevs_tgt;
+  return cost_horiz_first < cost_vert_first;
+}
+
 /* ---------------------------------------------------------- */
 void AtmosphereOutput::restart (const std::string& filename)
 {
@@ -253,7 +349,7 @@ void AtmosphereOutput::restart (const std::string& filename)
 
 void AtmosphereOutput::init()
 {
-  auto fm_after_hr = m_field_mgrs[AfterHorizRemap];
+  auto fm_after_hr = m_field_mgrs[last_remap_phase()];
   m_io_grid  = fm_after_hr->get_grid();
 
   EKAT_REQUIRE_MSG (m_io_grid->is_unique(),
@@ -331,6 +427,17 @@ void AtmosphereOutput::init()
       // Create and store a Field to track the averaging count for this layout
       set_avg_cnt_tracking(fname,layout);
     }
+
+    if (m_time_series_chunk>0) {
+      // Snapshots are stored along the fastest striding dim, so the decomposition
+      // (on the first dim) is unaffected
+      m_vars_dims[fname].push_back("time_in_chunk");
+      const auto size = fm_scorpio->get_field(fname).get_header().get_alloc_properties().get_num_scalars();
+      m_time_series_buffers[fname].resize(size*m_time_series_chunk,m_fill_value);
+    }
+  }
+  if (m_time_series_chunk>0) {
+    m_dims_len["time_in_chunk"] = m_time_series_chunk;
   }
 
   // For non-instantaneous output, ensure scorpio fields are
@@ -387,20 +494,30 @@ run (const std::string& filename,
   }; // end apply_remap
 
   // If needed, remap fields from their grid to the unique grid, for I/O
-  if (m_vert_remapper) {
+  auto vert_remap = [&]() {
     start_timer("EAMxx::IO::vert_remap");
     apply_remap(*m_vert_remapper);
     stop_timer("EAMxx::IO::vert_remap");
-  }
-
-  if (m_horiz_remapper) {
+  };
+  auto horiz_remap = [&]() {
     start_timer("EAMxx::IO::horiz_remap");
     apply_remap(*m_horiz_remapper);
     stop_timer("EAMxx::IO::horiz_remap");
+  };
+  if (m_horiz_remap_first) {
+    horiz_remap();
+    vert_remap();
+  } else {
+    if (m_vert_remapper) {
+      vert_remap();
+    }
+    if (m_horiz_remapper) {
+      horiz_remap();
+    }
   }
 
   auto fm_scorpio = m_field_mgrs[Scorpio];
-  auto fm_after_hr = m_field_mgrs[AfterHorizRemap];
+  auto fm_after_hr = m_field_mgrs[last_remap_phase()];
 
   // If tracking avg count, update the count at each field location separately.
   // We do count++ only where the fields are NOT equal to the fill value.
@@ -442,14 +559,9 @@ run (const std::string& filename,
         if (output_step and m_avg_type==OutputAvgType::Average) {
           int min_count = static_cast<int>(std::floor(m_avg_coeff_threshold*nsteps_since_last_output));
 
-          // Recycle mask to find where count<thresh
+          // Recycle mask to find where count<thresh. Later, we divide fields by count
+          // only where mask=0, and set them to fill_val elsewhere, so count=0 is harmless
           compute_mask<Comparison::LE>(count,min_count,mask);
-
-          // Later, we divide fields by count. By setting count=1 where count<thresholt,
-          // we can later do
-          //   f.scale_inv(count); // Requires count!=0 anywhere
-          //   f.deep_copy(fill_val,mask)
-          count.deep_copy(1,mask);
         }
       }
       count.get_header().set_extra_data("updated",true);
@@ -482,10 +594,9 @@ run (const std::string& filename,
         if (m_track_avg_cnt) {
           auto avg_count = m_field_to_avg_count.at(name);
 
-          f_out.scale_inv(avg_count);
-
+          // Divide by count and set fill value where count<=threshold, in one pass
           const auto& mask = avg_count.get_header().get_extra_data<Field>("mask");
-          f_out.deep_copy(m_fill_value,mask);
+          assign(f_out, where(mask, m_fill_value, f_out/expr::as<int>(avg_count)));
         } else {
           // Divide by steps count only when the summation is complete
           f_out.scale(Real(1.0) / nsteps_since_last_output);
@@ -495,6 +606,17 @@ run (const std::string& filename,
       // Bring data to host
       f_out.sync_to_host();
 
+      if (m_time_series_chunk>0) {
+        // Store the snapshot in the buffer; the chunk is written by write_time_series_chunk
+        const auto data = f_out.get_internal_view_data<const Real,Host>();
+        auto& buf = m_time_series_buffers.at(name);
+        const int size = buf.size() / m_time_series_chunk;
+        for (int i=0; i<size; ++i) {
+          buf[i*m_time_series_chunk + m_time_series_slot] = data[i];
+        }
+        continue;
+      }
+
       // Write
       auto func_start = std::chrono::steady_clock::now();
       scorpio::write_var(filename,name,f_out.get_internal_view_data<Real,Host>());
@@ -504,6 +626,13 @@ run (const std::string& filename,
     }
   }
 
+  if (output_step and m_time_series_chunk>0) {
+    EKAT_REQUIRE_MSG (m_time_series_slot<m_time_series_chunk,
+        "Error! Time-series chunk overflow. Did you forget to call write_time_series_chunk?\n"
+        " - chunk size: " + std::to_string(m_time_series_chunk) + "\n");
+    ++m_time_series_slot;
+  }
+
   if (is_write_step) {
     if (m_atm_logger) {
       m_atm_logger->info("  Done! Elapsed time: " + std::to_string(duration_write/1000.0) +" seconds");
@@ -511,6 +640,23 @@ run (const std::string& filename,
   }
 } // run
 
+void AtmosphereOutput::
+write_time_series_chunk (const std::string& filename)
+{
+  if (m_time_series_slot==0) {
+    return;
+  }
+
+  for (auto const& name : m_fields_names) {
+    auto& buf = m_time_series_buffers.at(name);
+    scorpio::write_var(filename,name,buf.data());
+
+    // Unused slots of a partial chunk must read as fill value
+    std::fill(buf.begin(),buf.end(),m_fill_value);
+  }
+  m_time_series_slot = 0;
+}
+
 long long AtmosphereOutput::
 res_dep_memory_footprint () const
 {
@@ -808,6 +954,11 @@ void AtmosphereOutput::
 compute_diagnostics(const bool allow_invalid_fields)
 {
   for (auto diag : m_diagnostics) {
+    // If another stream already computed this diag for the current inputs, we're done
+    if (m_diag_registry->is_up_to_date(diag)) {
+      continue;
+    }
+
     // Check if all inputs are valid
     bool computable = true;
     bool computed = false;
@@ -835,7 +986,9 @@ compute_diagnostics(const bool allow_invalid_fields)
       }
     }
 
-    if (not computed) {
+    if (computed) {
+      m_diag_registry->mark_computed(diag);
+    } else {
       // The diag was either not computable or it may have failed to compute
       // (e.g., t=0 output with a flux-like diag).
       // If we're allowing invalid fields, then we should simply set diag=m_fill_value
@@ -857,12 +1010,21 @@ init_diagnostics ()
   auto fm_model = m_field_mgrs[FromModel];
   auto fm_grid = m_field_mgrs[FromModel]->get_grid();
 
+  // If no registry was passed, use one private to this stream
+  if (m_diag_registry==nullptr) {
+    m_diag_registry = std::make_shared<OutputDiagRegistry>();
+  }
+
   // NOTE: lambda's cannot call themselves recursively. So store the lambda
   //       inside a std::function, so that the lambda body CAN call create_diag.
   std::function<void(const std::string&)> create_diag;
   create_diag = [&](const std::string& name) {
-    // Create the diag
-    auto diag = create_diagnostic(name,fm_model->get_grid());
+    // If another stream already created this diag, reuse it. Its inputs are
+    // already set, but we still need to add its diag dependencies to this
+    // stream, so that they are evaluated (in order) when this stream runs.
+    const bool shared = m_diag_registry->has_diag(name,fm_grid->name());
+    auto diag = shared ? m_diag_registry->get_diag(name,fm_grid->name())
+                       : create_diagnostic(name,fm_grid);
 
     // Set inputs in the diag (and recurse if inputs are also diags not yet created)
     for (const auto& freq : diag->get_required_field_requests()) {
@@ -873,20 +1035,27 @@ init_diagnostics ()
         create_diag(dep_name);
       }
 
-      auto dep = fm_model->get_field(dep_name);
-      diag->set_required_field(dep);
+      if (not shared) {
+        auto dep = fm_model->get_field(dep_name);
+        diag->set_required_field(dep);
+      }
     }
 
-    // Initialize the diag
-    diag->initialize(util::TimeStamp(),RunType::Initial);
+    if (not shared) {
+      // Initialize the diag
+      diag->initialize(util::TimeStamp(),RunType::Initial);
+
+      // Add the field to the diag group
+      auto diag_field = diag->get_diagnostic();
+      diag_field.get_header().get_tracking().add_group("diagnostic");
+
+      m_diag_registry->add_diag(name,fm_grid->name(),diag);
+    }
 
     // Set the diag field in the FM
     auto diag_field = diag->get_diagnostic();
     fm_model->add_field(diag_field);
 
-    // Add the field to the diag group
-    diag_field.get_header().get_tracking().add_group("diagnostic");
-
     // Some diags need some extra setup or trigger extra behaviors
     std::string diag_avg_cnt_name = "";
     auto& params = diag->get_params();
@@ -3,6 +3,7 @@
 
 #include "share/io/eamxx_scorpio_interface.hpp"
 #include "share/io/eamxx_io_utils.hpp"
+#include "share/io/eamxx_output_diag_registry.hpp"
 #include "share/field/field_manager.hpp"
 #include "share/grid/abstract_grid.hpp"
 #include "share/grid/grids_manager.hpp"
@@ -29,6 +30,7 @@
  *  filename_prefix:                    STRING
  *  averaging_type:                     STRING
  *  max_snapshots_per_file:             INT                   (default: 1)
+ *  time_series_chunk_size:             INT                   (default: 0)
  *  fields:
  *     GRID_NAME_1:
  *        field_names:                  ARRAY OF STRINGS
@@ -63,6 +65,12 @@
  *                        SEGrid fields to PointGrid fields on the fly, to save on output size)
  *  - max_snapshots_per_file: the maximum number of snapshots saved per file. After this many
  *    snapshots, the current files is closed and a new file created.
+ *  - time_series_chunk_size: if N>0, snapshots are buffered in memory, and written N at a time,
+ *    with an extra 'time_in_chunk' dimension as the fastest striding one. This way, the time
+ *    series of each column is contiguous in the file, which makes single-point analysis much
+ *    cheaper. Only for instant output. Typically used together with horiz_remap_file, to
+ *    sample a handful of columns. A partial chunk is written (padded with the fill value)
+ *    at checkpoints and when the file is closed.
  *  - Output: parameters for output control
  *    - frequency: the frequency of output writes (in the units specified by ${Output frequency_units})
  *    - frequency_units: the units of output frequency (nsteps, nmonths, nyears, nhours, ndays,...)
@@ -116,9 +124,12 @@ public:
   virtual ~AtmosphereOutput () = default;
 
   // Constructor
+  // If a diag registry is passed, diagnostics are looked up (and added) there,
+  // so that they can be shared with other output streams.
   AtmosphereOutput(const ekat::Comm& comm, const ekat::ParameterList& params,
                    const std::shared_ptr<const fm_type>& field_mgr,
-                   const std::string& grid_name);
+                   const std::string& grid_name,
+                   const std::shared_ptr<OutputDiagRegistry>& diag_registry = nullptr);
 
   // Short version for outputing a list of fields (no remapping supported)
   AtmosphereOutput(const ekat::Comm& comm,
@@ -137,6 +148,9 @@ public:
             const int nsteps_since_last_output,
             const bool allow_invalid_fields = false);
 
+  // Write the snapshots buffered so far (if time_series_chunk_size>0) as one time record
+  void write_time_series_chunk (const std::string& filename);
+
   long long res_dep_memory_footprint () const;
 
   std::shared_ptr<const AbstractGrid> get_io_grid () const {
@@ -160,6 +174,11 @@ protected:
   void set_decompositions(const std::string& filename);
   void compute_diagnostics (const bool allow_invalid_fields);
   void init_diagnostics ();
+  bool horiz_remap_first_is_cheaper (const std::string& vert_remap_file,
+                                     const std::string& horiz_remap_file,
+                                     const int nlevs_src) const;
+  void setup_vert_remapper (const std::shared_ptr<const FieldManager>& fm_src,
+                            const std::string& vert_remap_file);
   strvec_t get_var_dimnames (const FieldLayout& layout) const;
 
   // Tracking the averaging of any filled values:
@@ -187,6 +206,8 @@ protected:
   // NOTE: if avg_type!=Instant, then ALL fields in the last two field mgrs are different, otherwise SOME field
   //       MAY be the same. E.g., field that are NOT subfields and are NOT padded can be "soft copies", to reduce
   //       memory footprint and runtime costs.
+  // NOTE: if both vert and horiz remap are from file, the user can ask to coarsen first (see remap_order
+  //       in the constructor), in which case the chain is FromModel -> AfterHorizRemap -> AfterVertRemap -> Scorpio
   enum Phase {
     FromModel,        // Output fields as from the model (or diags computed from model fields)
     AfterVertRemap,   // Output fields after vertical remap
@@ -195,9 +216,13 @@ protected:
   };
   std::map<Phase,std::shared_ptr<fm_type>> m_field_mgrs;
 
+  // The phase whose fields are copied/accumulated into the Scorpio ones
+  Phase last_remap_phase () const { return m_horiz_remap_first ? AfterVertRemap : AfterHorizRemap; }
+
   std::shared_ptr<const grid_type>      m_io_grid;
   std::shared_ptr<remapper_type>        m_horiz_remapper;
   std::shared_ptr<remapper_type>        m_vert_remapper;
+  bool                                  m_horiz_remap_first = false;
 
   // How to combine multiple snapshots in the output: instant, Max, Min, Average
   OutputAvgType                         m_avg_type;
@@ -211,6 +236,7 @@ protected:
   strmap_t<strvec_t>                    m_vars_dims;
   strmap_t<int>                         m_dims_len;
   std::list<diag_ptr_type>              m_diagnostics;
+  std::shared_ptr<OutputDiagRegistry>   m_diag_registry;
 
   DefaultMetadata                       m_default_metadata;
 
@@ -223,6 +249,11 @@ protected:
 
   bool m_add_time_dim;
   bool m_track_avg_cnt = false;
+
+  // If >0, buffer this many snapshots (on host), and write them as a single time record
+  int                                   m_time_series_chunk = 0;
+  int                                   m_time_series_slot  = 0;
+  strmap_t<std::vector<Real>>           m_time_series_buffers;
   std::string m_decomp_dimname = "";
 
   // The logger to be used throughout the ATM to log message
@@ -37,6 +37,9 @@ public:
 
   std::string name() const override { return "MyDiag"; }
 
+  // Counts the evaluations of all MyDiag instances
+  static int num_evaluations;
+
   void set_grids (const std::shared_ptr<const GridsManager> gm) override {
     using namespace ekat::units;
     using namespace ShortFieldTagsNames;
@@ -78,6 +81,7 @@ protected:
 
     m_diagnostic_output.deep_copy(f_in);
     m_diagnostic_output.update(m_one,dt,2.0);
+    ++num_evaluations;
   }
 
   void initialize_impl (const RunType /* run_type */ ) override {
@@ -96,6 +100,8 @@ protected:
   Field m_one;
 };
 
+int MyDiag::num_evaluations = 0;
+
 util::TimeStamp get_t0 () {
   return util::TimeStamp({2023,2,17},{0,0,0});
 }
@@ -276,6 +282,60 @@ void read (const int seed, const ekat::Comm& comm)
   }
 }
 
+// Two output managers requesting the same diag, and sharing a diag registry
+void shared_diags (const int seed, const ekat::Comm& comm)
+{
+  auto gm = get_gm(comm);
+  auto grid = gm->get_grid("point_grid");
+
+  auto t0 = get_t0();
+  auto dt = get_dt();
+
+  auto fm = get_fm(grid,t0,seed);
+  std::vector<std::string> fnames = {"MyDiag"};
+
+  auto registry = std::make_shared<OutputDiagRegistry>();
+  std::vector<std::shared_ptr<OutputManager>> oms;
+  for (const std::string prefix : {"io_diags_shared_1","io_diags_shared_2"}) {
+    ekat::ParameterList om_pl;
+    om_pl.set("filename_prefix",prefix);
+    om_pl.set("field_names",fnames);
+    om_pl.set("averaging_type", std::string("instant"));
+    auto& ctrl_pl = om_pl.sublist("output_control");
+    ctrl_pl.set("frequency_units",std::string("nsteps"));
+    ctrl_pl.set("frequency",1);
+    ctrl_pl.set("save_grid_data",false);
+
+    auto om = oms.emplace_back(std::make_shared<OutputManager>());
+    om->initialize(comm, om_pl, t0, false);
+    om->set_diag_registry(registry);
+    om->setup(fm,gm->get_grid_names());
+  }
+
+  // The diag is created once, and shared by the two managers
+  REQUIRE (registry->num_diags()==1);
+
+  for (auto it : fm->get_repo()) {
+    auto& f = *it.second;
+    Field one = f.clone("one");
+    one.deep_copy(1.0);
+    f.get_header().get_tracking().update_time_stamp(t0+dt);
+    f.update(one,1.0,1.0);
+  }
+
+  // The diag is evaluated only once for the same inputs time stamp
+  const int n0 = MyDiag::num_evaluations;
+  for (auto& om : oms) {
+    om->init_timestep(t0,dt);
+    om->run (t0+dt);
+  }
+  REQUIRE (MyDiag::num_evaluations==n0+1);
+
+  for (auto& om : oms) {
+    om->finalize();
+  }
+}
+
 TEST_CASE ("io_diags") {
   ekat::Comm comm(MPI_COMM_WORLD);
   scorpio::init_subsystem(comm);
@@ -300,6 +360,10 @@ TEST_CASE ("io_diags") {
   write(seed,comm);
   read(seed,comm);
   print(" PASS\n");
+
+  print ("-> Share diagnostics across output managers ", 40);
+  shared_diags(seed,comm);
+  print(" PASS\n");
   scorpio::finalize_subsystem();
 }
 
@@ -160,7 +160,77 @@ TEST_CASE("io_remap_test","io_remap_test")
     }
   }
   print (" -> Check output ... done\n",comm);
-  
+
+  // Write a few more snapshots as time series (starting with t0 output): with 4 snapshots
+  // and chunks of size 3, we get a full chunk and a partial one (padded with fill value)
+  print (" -> Write time-series output ... \n",comm);
+  const int chunk  = 3;
+  const int nsnaps = 4;
+  auto ts_params = output_params(remap_filename);
+  ts_params.set<std::string>("filename_prefix","horiz_sampling_ts");
+  ts_params.set<int>("time_series_chunk_size",chunk);
+  OutputManager om_ts;
+  om_ts.initialize (comm, ts_params, t0, false);
+  om_ts.setup(fm,{gname});
+
+  std::vector<Field> s2d_snaps, s3d_snaps;
+  std::vector<double> times;
+  auto t = t0;
+  for (int n=0; n<nsnaps; ++n) {
+    randomize(s2d_src,engine,pdf);
+    randomize(s3d_src,engine,pdf);
+    s2d_snaps.push_back(s2d_src.clone());
+    s3d_snaps.push_back(s3d_src.clone());
+
+    if (n>0) {
+      om_ts.init_timestep(t,dt);
+      t += dt;
+    }
+    om_ts.run(t);
+    times.push_back(t.days_from(t0));
+  }
+  om_ts.finalize();
+  print (" -> Write time-series output ... done\n",comm);
+
+  print (" -> Check time-series output ... \n",comm);
+  std::string ts_filename = "horiz_sampling_ts.INSTANT.nsteps_x1.np" + std::to_string(comm.size()) + "." + t0.to_string() + ".nc";
+  scorpio::register_file(ts_filename,scorpio::FileMode::Read);
+  REQUIRE (scorpio::get_time_len(ts_filename)==2);
+  REQUIRE (scorpio::get_dimlen(ts_filename,"time_in_chunk")==chunk);
+  scorpio::set_dim_decomp(ts_filename,"ncol",comm.rank()*nlcols_tgt,nlcols_tgt);
+
+  const Real fill_value = constants::DefaultFillValue<float>().value;
+  std::vector<double> times_file(chunk);
+  std::vector<Real> s2d_file(nlcols_tgt*chunk), s3d_file(nlcols_tgt*nlevs*chunk);
+  for (int irec=0; irec<2; ++irec) {
+    scorpio::read_var(ts_filename,"time_series_time",times_file.data(),irec);
+    scorpio::read_var(ts_filename,"s2d",s2d_file.data(),irec);
+    scorpio::read_var(ts_filename,"s3d",s3d_file.data(),irec);
+    for (int islot=0; islot<chunk; ++islot) {
+      const int n = irec*chunk + islot;
+      if (n>=nsnaps) {
+        // Unused slots of the last chunk
+        REQUIRE (times_file[islot]==static_cast<double>(fill_value));
+        for (int i=0; i<nlcols_tgt; ++i) {
+          REQUIRE (s2d_file[i*chunk+islot]==fill_value);
+        }
+        continue;
+      }
+      REQUIRE (times_file[islot]==times[n]);
+      auto s2d_src_h = s2d_snaps[n].get_view<const Real* ,Host>();
+      auto s3d_src_h = s3d_snaps[n].get_view<const Real**,Host>();
+      for (int i=0; i<nlcols_tgt; ++i) {
+        // Each column's time series is contiguous
+        REQUIRE (s2d_file[i*chunk+islot]==s2d_src_h(2*i+1));
+        for (int k=0; k<nlevs; ++k) {
+          REQUIRE (s3d_file[(i*nlevs+k)*chunk+islot]==s3d_src_h(2*i+1,k));
+        }
+      }
+    }
+  }
+  scorpio::release_file(ts_filename);
+  print (" -> Check time-series output ... done\n",comm);
+
   // Cleanup scorpio
   scorpio::finalize_subsystem();
 }
@@ -229,7 +229,7 @@ TEST_CASE("io_remap_test","io_remap_test")
   // Setup remapped output streams and run them
   print (" -> Create output ... \n",io_comm);
   register_diagnostics();
-  OutputManager om_source, om_vert, om_horiz, om_vert_horiz;
+  OutputManager om_source, om_vert, om_horiz, om_vert_horiz, om_horiz_vert;
   const int p_ref = (int)set_pressure(p_top, p_bot, nlevs_src+1,nlevs_src-1);
 
   print ("    -> source data ... \n",io_comm);
@@ -271,6 +271,17 @@ TEST_CASE("io_remap_test","io_remap_test")
   om_vert_horiz.run(t0+dt);
   om_vert_horiz.finalize();
   print ("    -> vertical-horizontal remap ... done\n",io_comm);
+
+  print ("    -> horizontal-vertical remap ... \n",io_comm);
+  auto horiz_vert_remap_control = set_output_params("remap_horizontal_vertical",remap_filename,p_ref,true,true);
+  horiz_vert_remap_control.set<std::string>("remap_order","horiz_first");
+  om_horiz_vert.initialize(io_comm,horiz_vert_remap_control,t0,false);
+  om_horiz_vert.setup(field_manager,gm->get_grid_names());
+  io_comm.barrier();
+  om_horiz_vert.init_timestep(t0,dt);
+  om_horiz_vert.run(t0+dt);
+  om_horiz_vert.finalize();
+  print ("    -> horizontal-vertical remap ... done\n",io_comm);
   print (" -> Create output ... done\n",io_comm);
 
 
@@ -551,6 +562,80 @@ TEST_CASE("io_remap_test","io_remap_test")
     print ("    -> vertical + horizontal remap ... done\n",io_comm);
   }
   // ------------------------------------------------------------------------------------------------------
+  //                          ---  Horizontal + Vertical Remapping (coarsen first) ---
+  {
+    const float mask_val = horiz_vert_remap_control.isParameter("Fill Value")
+                         ? horiz_vert_remap_control.get<double>("Fill Value") : constants::DefaultFillValue<float>().value;
+    print ("    -> horizontal + vertical remap ... \n",io_comm);
+    auto gm_hv   = get_test_gm(io_comm,ncols_tgt,nlevs_tgt);
+    auto grid_hv = gm_hv->get_grid("point_grid");
+    auto fm_hv   = get_test_fm(grid_hv,true,p_ref);
+    auto hv_in   = set_input_params("remap_horizontal_vertical",io_comm,t0.to_string(),p_ref);
+    AtmosphereInput test_input(hv_in,fm_hv);
+    test_input.read_variables();
+    test_input.finalize();
+
+    // Here we vertically remap the coarsened fields using the coarsened pressure. Since the data
+    // is linear in pressure with the same slope in all columns, the unmasked values are the same
+    // as in the vertical + horizontal case. However, a target level is masked only if it is
+    // outside the range of the coarsened pressure. The pressure-sliced variable is 2d, so it
+    // is only coarsened, and we expect the same value as in the vertical + horizontal case.
+    const auto& Yf_v_hv = fm_hv->get_field("Y_flat").get_view<Real*,Host>();
+    const auto& Ys_v_hv = fm_hv->get_field("Y_int_at_"+std::to_string(p_ref)+"Pa").get_view<Real*,Host>();
+    const auto& Ym_v_hv = fm_hv->get_field("Y_mid").get_view<Real**,Host>();
+    const auto& Yi_v_hv = fm_hv->get_field("Y_int").get_view<Real**,Host>();
+    const auto& Vm_v_hv = fm_hv->get_field("V_mid").get_view<Real***,Host>();
+    const auto& Vi_v_hv = fm_hv->get_field("V_int").get_view<Real***,Host>();
+
+    for (int ii=0; ii<ncols_tgt_l; ii++) {
+      const int col1 = 2*ii;
+      const int col2 = 2*ii+1;
+      auto coarsen = [&](const Real v1, const Real v2) { return v1*wgt + v2*(1.0-wgt); };
+      REQUIRE(approx(Yf_v_hv(ii),coarsen(Yf_v(col1),Yf_v(col2))));
+      const Real pm_top = coarsen(pm_v(col1,0),pm_v(col2,0));
+      const Real pm_bot = coarsen(pm_v(col1,nlevs_src-1),pm_v(col2,nlevs_src-1));
+      const Real pi_top = coarsen(pi_v(col1,0),pi_v(col2,0));
+      const Real pi_bot = coarsen(pi_v(col1,nlevs_src),pi_v(col2,nlevs_src));
+      for (int jj=0; jj<nlevs_tgt; jj++) {
+        auto p_jj = p_tgt[jj];
+        const bool mid_masked = p_jj>pm_bot || p_jj<pm_top;
+        const bool int_masked = p_jj>pi_bot || p_jj<pi_top;
+        for (int cc=0; cc<3; cc++) {
+          const Real test_val = coarsen(calculate_output(p_jj,col1,cc),calculate_output(p_jj,col2,cc));
+          const Real test_mid = mid_masked ? mask_val : test_val;
+          const Real test_int = int_masked ? mask_val : test_val;
+          if (cc==0) {
+            REQUIRE(approx(Ym_v_hv(ii,jj), test_mid));
+            REQUIRE(approx(Yi_v_hv(ii,jj), test_int));
+          } else {
+            REQUIRE(approx(Vm_v_hv(ii,cc-1,jj), test_mid));
+            REQUIRE(approx(Vi_v_hv(ii,cc-1,jj), test_int));
+          }
+        }
+      }
+      Real Ys_exp = 0.0;
+      Real Ys_wgt = 0.0;
+      bool found  = false;
+      if (p_ref<=pi_v(col1,nlevs_src) && p_ref>=pi_v(col1,0)) {
+        found = true;
+        Ys_exp += calculate_output(p_ref,col1,0)*wgt;
+        Ys_wgt += wgt;
+      }
+      if (p_ref<=pi_v(col2,nlevs_src) && p_ref>=pi_v(col2,0)) {
+        found = true;
+        Ys_exp += calculate_output(p_ref,col2,0)*(1.0-wgt);
+        Ys_wgt += (1.0 - wgt);
+      }
+      if (found) {
+        Ys_exp /= Ys_wgt;
+      } else {
+        Ys_exp = mask_val;
+      }
+      REQUIRE(approx(Ys_v_hv(ii), Ys_exp));
+    }
+    print ("    -> horizontal + vertical remap ... done\n",io_comm);
+  }
+  // ------------------------------------------------------------------------------------------------------
   // All Done
   print (" -> Test Remapped Output ... done\n",io_comm);
   scorpio::finalize_subsystem();
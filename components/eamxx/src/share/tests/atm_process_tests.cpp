@@ -334,6 +334,25 @@ protected:
   }
 };
 
+// An AddOne process that counts how many times its state was reset
+class ResettableAddOne : public AddOne
+{
+public:
+  ResettableAddOne (const ekat::Comm& comm,const ekat::ParameterList& params)
+   : AddOne(comm,params)
+  {
+    m_supports_reset = params.get<bool>("supports_reset",true);
+  }
+
+  bool supports_state_reset () const { return m_supports_reset; }
+
+  int num_resets = 0;
+protected:
+  void reset_state_impl () { ++num_resets; }
+
+  bool m_supports_reset;
+};
+
 // ================================ TESTS ============================== //
 
 TEST_CASE("process_factory", "") {
@@ -582,6 +601,53 @@ TEST_CASE ("subcycling") {
   }
 }
 
+TEST_CASE ("reset_state") {
+  using namespace scream;
+
+  ekat::Comm comm(MPI_COMM_WORLD);
+  util::TimeStamp t0 ({2022,1,1},{0,0,0});
+  auto gm = create_gm(comm);
+
+  ekat::ParameterList params;
+  params.set<std::string>("grid_name", "point_grid");
+
+  auto ap = std::make_shared<ResettableAddOne>(comm,params);
+  ap->set_grids(gm);
+
+  Field f(ap->get_required_field_requests().front().fid);
+  f.allocate_view();
+  f.deep_copy(0);
+  f.get_header().get_tracking().update_time_stamp(t0);
+  ap->set_required_field(f.get_const());
+  ap->set_computed_field(f);
+
+  ap->initialize(t0,RunType::Initial);
+
+  const int dt = 5;
+  ap->run(dt);
+  REQUIRE (f.get_header().get_tracking().get_time_stamp()==t0+dt);
+
+  // Rewind the field, and reset the process: a new run restarts from t0
+  auto& track = f.get_header().get_tracking();
+  track.invalidate_time_stamp();
+  track.update_time_stamp(t0);
+  f.deep_copy(0);
+  ap->reset_state(t0);
+  REQUIRE (ap->num_resets==1);
+
+  ap->run(dt);
+  REQUIRE (track.get_time_stamp()==t0+dt);
+  auto v = f.get_view<const Real*,Host>();
+  for (int i=0; i<v.extent_int(0); ++i) {
+    REQUIRE (v[i]==1);
+  }
+
+  // A process that does not support a state reset must throw
+  params.set("supports_reset",false);
+  auto ap_no_reset = std::make_shared<ResettableAddOne>(comm,params);
+  REQUIRE_THROWS (ap_no_reset->reset_state(t0));
+}
+
 TEST_CASE ("diagnostics") {
 
   //TODO: This test needs a field manager so that changes in Field A are seen everywhere.
@@ -52,7 +52,8 @@ void root_print (const ekat::Comm& comm,
 void run_tests (const std::shared_ptr<const AbstractGrid>& grid,
                 const strvec_t& input_files, util::TimeStamp t_beg,
                 const util::TimeLine timeline,
-                const DataInterpolation::VRemapType vr_type = DataInterpolation::None)
+                const DataInterpolation::VRemapType vr_type = DataInterpolation::None,
+                const bool read_only_needed_cols = false)
 {
   auto t_end = t_beg + t_beg.days_in_curr_month()*spd;
   auto t0 = t_beg + (t_end-t_beg)/2;
@@ -124,8 +125,12 @@ void run_tests (const std::shared_ptr<const AbstractGrid>& grid,
   interp->setup_time_database(input_files,util::TimeLine::YearlyPeriodic);
   interp->create_horiz_remappers (map_file);
   interp->create_vert_remapper (vremap_data);
+  interp->toggle_read_only_needed_cols(read_only_needed_cols);
   interp->init_data_interval(t0);
 
+  // Make sure we did not silently fall back to reading the whole data on each rank
+  REQUIRE (interp->reads_only_needed_cols()==read_only_needed_cols);
+
   // We jump ahead by 2 months, but the shift interval logic cannot keep up with
   // a dt that long, so we should get an error due to the interpolation param being
   // outside the [0,1] interval.
@@ -316,6 +321,25 @@ TEST_CASE ("interpolation")
         run_tests (hvfine_grid,files_no_ilev,t_beg,timeline,P3D);
         root_print(comm,"  timeline=PERIODIC, horiz_remap=YES, vert_remap=p3d ......... PASS\n");
       }
+      SECTION ("no-vert-needed-cols") {
+        root_print(comm,"  timeline=PERIODIC, horiz_remap=YES, vert_remap=NO,  read only needed cols ..........\n");
+        run_tests (hfine_grid,files,t_beg,timeline,NOP,true);
+        root_print(comm,"  timeline=PERIODIC, horiz_remap=YES, vert_remap=NO,  read only needed cols .......... PASS\n");
+      }
+      SECTION ("p3d-vert-needed-cols") {
+        root_print(comm,"  timeline=PERIODIC, horiz_remap=YES, vert_remap=p3d, read only needed cols .........\n");
+        run_tests (hvfine_grid,files_no_ilev,t_beg,timeline,P3D,true);
+        root_print(comm,"  timeline=PERIODIC, horiz_remap=YES, vert_remap=p3d, read only needed cols ......... PASS\n");
+      }
+      SECTION ("needed-cols-shared-session") {
+        // Reading the same files with different dofs distributions in the same scorpio session
+        // must not reuse PIO decompositions across distributions
+        root_print(comm,"  timeline=PERIODIC, horiz_remap=YES, vert_remap=NO,  mixed cols distributions .......\n");
+        run_tests (hfine_grid,files,t_beg,timeline,NOP,true);
+        run_tests (hfine_grid,files,t_beg,timeline,NOP,false);
+        run_tests (hfine_grid,files,t_beg,timeline,NOP,true);
+        root_print(comm,"  timeline=PERIODIC, horiz_remap=YES, vert_remap=NO,  mixed cols distributions ....... PASS\n");
+      }
     }
   }
 
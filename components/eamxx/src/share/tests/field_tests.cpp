@@ -7,6 +7,7 @@
 #include "share/field/field.hpp"
 #include "share/field/field_manager.hpp"
 #include "share/field/field_utils.hpp"
+#include "share/field/field_expression.hpp"
 #include "share/util/eamxx_setup_random_test.hpp"
 
 #include "share/grid/point_grid.hpp"
@@ -970,6 +971,84 @@ TEST_CASE ("update") {
       REQUIRE (views_are_equal(f3,f2));
     }
   }
+
+  SECTION ("expressions") {
+    SECTION ("real") {
+      Field x = f_real.clone("x");
+      Field w = f_real.clone("w");
+      Field z = f_real.clone("z");
+      randomize (w,engine,rpdf);
+      z.deep_copy(2.0);
+
+      // y = 2*x + 4*(w/z), as a chain of update/scale calls
+      // NOTE: use powers of 2, so that only the final sum involves rounding
+      Field y1 = w.clone("y1");
+      y1.scale_inv(z);
+      y1.update(x,2,4);
+
+      Field y2 = f_real.clone("y2");
+      assign(y2, 2*x + 4*(w/z));
+      REQUIRE (views_are_equal(y1,y2));
+
+      // The output field can appear in the expression
+      Field y3 = x.clone("y3");
+      assign(y3, -y3 + 2*x);
+      REQUIRE (views_are_equal(y3,x));
+
+      // Layout mismatch
+      Field sub = f_real.subfield(0,0).clone("sub");
+      REQUIRE_THROWS (assign(y2, x + sub));
+
+      // Wrong data type: int fields must be read with expr::as<int>
+      REQUIRE_THROWS (assign(y2, x + f_int));
+    }
+
+    SECTION ("masked") {
+      const Real fill = -99;
+
+      Field x = f_real.clone("x");
+      Field count = f_int.clone("count");
+      count.deep_copy(4);
+      for (int icol=0; icol<ncol; icol+=2) {
+        count.subfield(0,icol).deep_copy(0);
+      }
+      Field mask = f_int.clone("mask");
+      compute_mask<Comparison::LE>(count,0,mask);
+
+      // Reference: set count=1 where masked, divide, then set fill where masked
+      Field y1 = x.clone("y1");
+      Field c1 = count.clone("c1");
+      c1.deep_copy(1,mask);
+      y1.scale_inv(c1);
+      y1.deep_copy(fill,mask);
+
+      Field y2 = x.clone("y2");
+      assign(y2, where(mask, fill, y2/expr::as<int>(count)));
+      REQUIRE (views_are_equal(y1,y2));
+
+      // Comparisons can be used as conditions too
+      Field y3 = x.clone("y3");
+      assign(y3, where(expr::as<int>(count)<=0, fill, y3/expr::as<int>(count)));
+      REQUIRE (views_are_equal(y1,y3));
+    }
+
+    SECTION ("subfields") {
+      // Non-contiguous subfields go through the strided views
+      Field x = f_real.clone("x");
+      Field y = f_real.clone("y");
+      y.deep_copy(0);
+      auto xs = x.subfield(1,1);
+      auto ys = y.subfield(1,1);
+
+      assign(ys, expr::max(xs,0.5));
+
+      Field ref = xs.clone("ref");
+      Field half = ref.clone("half");
+      half.deep_copy(0.5);
+      ref.max(half);
+      REQUIRE (views_are_equal(ys,ref));
+    }
+  }
 }
 
 TEST_CASE ("sync_subfields") {
@@ -0,0 +1,218 @@
+#include <catch2/catch.hpp>
+
+#include "share/grid/remap/horiz_interp_remapper_data.hpp"
+#include "share/grid/point_grid.hpp"
+#include "share/io/eamxx_scorpio_interface.hpp"
+
+#include <cstdio>
+
+namespace scream {
+
+using gid_type = AbstractGrid::gid_type;
+
+void root_print (const std::string& msg, const ekat::Comm& comm) {
+  if (comm.am_i_root()) {
+    printf("%s",msg.c_str());
+  }
+}
+
+// Fine grid with a linear decomposition of ngdofs dofs
+std::shared_ptr<AbstractGrid>
+build_fine_grid (const ekat::Comm& comm, const int ngdofs)
+{
+  int nldofs = ngdofs / comm.size();
+  int remainder = ngdofs % comm.size();
+  int offset = nldofs * comm.rank() + std::min(comm.rank(),remainder);
+  if (comm.rank()<remainder) {
+    ++nldofs;
+  }
+  auto grid = std::make_shared<PointGrid>("fine",nldofs,2,comm);
+  auto dofs_h = grid->get_dofs_gids().get_view<gid_type*,Host>();
+  for (int i=0; i<nldofs; ++i) {
+    dofs_h(i) = offset + i;
+  }
+  grid->get_dofs_gids().sync_to_dev();
+  return grid;
+}
+
+// Each coarse dof is the average of two adjacent fine dofs. The value
+// of the weights only changes the file content (hence its hash)
+void create_remap_file (const std::string& filename, const int ngdofs_tgt, const double w)
+{
+  const int ngdofs_src = ngdofs_tgt + 1;
+  const int nnz = 2*ngdofs_tgt;
+
+  scorpio::register_file(filename, scorpio::FileMode::Write);
+
+  scorpio::define_dim(filename,"n_a", ngdofs_src);
+  scorpio::define_dim(filename,"n_b", ngdofs_tgt);
+  scorpio::define_dim(filename,"n_s", nnz);
+
+  scorpio::define_var(filename,"col",{"n_s"},"int");
+  scorpio::define_var(filename,"row",{"n_s"},"int");
+  scorpio::define_var(filename,"S"  ,{"n_s"},"double");
+
+  scorpio::enddef(filename);
+
+  std::vector<int> col(nnz), row(nnz);
+  std::vector<double> S(nnz,w);
+  for (int i=0; i<ngdofs_tgt; ++i) {
+    row[2*i] = i;
+    row[2*i+1] = i;
+    col[2*i] = i;
+    col[2*i+1] = i+1;
+  }
+
+  scorpio::write_var(filename,"row",row.data());
+  scorpio::write_var(filename,"col",col.data());
+  scorpio::write_var(filename,"S",    S.data());
+
+  scorpio::release_file(filename);
+}
+
+template<typename ViewT>
+bool same_view (const ViewT& lhs, const ViewT& rhs)
+{
+  auto lhs_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),lhs);
+  auto rhs_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),rhs);
+  if (lhs_h.size()!=rhs_h.size()) {
+    return false;
+  }
+  for (size_t i=0; i<lhs_h.size(); ++i) {
+    if (lhs_h(i)!=rhs_h(i)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool same_gids (const AbstractGrid& lhs, const AbstractGrid& rhs)
+{
+  auto lhs_h = lhs.get_dofs_gids().get_view<const gid_type*,Host>();
+  auto rhs_h = rhs.get_dofs_gids().get_view<const gid_type*,Host>();
+  if (lhs_h.size()!=rhs_h.size()) {
+    return false;
+  }
+  for (size_t i=0; i<lhs_h.size(); ++i) {
+    if (lhs_h(i)!=rhs_h(i)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Check that all ranks agree with the local value of a flag
+bool all_ranks_agree (const ekat::Comm& comm, const bool flag)
+{
+  int min = flag, max = flag;
+  comm.all_reduce(&min,1,MPI_MIN);
+  comm.all_reduce(&max,1,MPI_MAX);
+  return min==max;
+}
+
+void check_same_data (const HorizRemapperData& lhs, const HorizRemapperData& rhs)
+{
+  REQUIRE (same_view(lhs.row_offsets,rhs.row_offsets));
+  REQUIRE (same_view(lhs.col_lids,rhs.col_lids));
+  REQUIRE (same_view(lhs.weights,rhs.weights));
+  REQUIRE (same_gids(*lhs.coarse_grid,*rhs.coarse_grid));
+  REQUIRE (same_gids(*lhs.ov_coarse_grid,*rhs.ov_coarse_grid));
+}
+
+TEST_CASE("horiz_remap_cache")
+{
+  ekat::Comm comm(MPI_COMM_WORLD);
+
+  root_print ("\n +------------------------------------+\n",comm);
+  root_print (" |   Testing horiz remap data cache   |\n",comm);
+  root_print (" +------------------------------------+\n\n",comm);
+
+  scorpio::init_subsystem(comm);
+
+  const int nldofs_tgt = 3;
+  const int ngdofs_tgt = nldofs_tgt*comm.size();
+  const auto np = std::to_string(comm.size());
+  const std::string map_file = "hrc_tests_map.np" + np + ".nc";
+  const std::string cache_dir = ".";
+  const std::string cache_file = cache_dir + "/" + map_file + ".coarsen.np" + np
+                               + "." + std::to_string(comm.rank()) + ".crs";
+
+  create_remap_file(map_file,ngdofs_tgt,0.5);
+  auto fine_grid = build_fine_grid(comm,ngdofs_tgt+1);
+
+  // Reference data, built without the cache
+  HorizRemapperData::set_cache_dir("");
+  HorizRemapperData ref;
+  ref.build(map_file,fine_grid,comm,InterpType::Coarsen);
+  REQUIRE (not ref.loaded_from_cache);
+
+  // Remove cache files from previous runs of this test
+  std::remove(cache_file.c_str());
+  comm.barrier();
+  HorizRemapperData::set_cache_dir(cache_dir);
+
+  SECTION ("save_and_reload") {
+    // No cache yet: build from the map file, and save the cache
+    HorizRemapperData first;
+    first.build(map_file,fine_grid,comm,InterpType::Coarsen);
+    REQUIRE (not first.loaded_from_cache);
+    check_same_data(first,ref);
+
+    // Now the cache is there
+    HorizRemapperData second;
+    second.build(map_file,fine_grid,comm,InterpType::Coarsen);
+    REQUIRE (second.loaded_from_cache);
+    check_same_data(second,ref);
+  }
+
+  SECTION ("map_hash_mismatch") {
+    HorizRemapperData first;
+    first.build(map_file,fine_grid,comm,InterpType::Coarsen);
+
+    // Same map file name, different content: the cache is stale
+    create_remap_file(map_file,ngdofs_tgt,0.25);
+    HorizRemapperData second;
+    second.build(map_file,fine_grid,comm,InterpType::Coarsen);
+    REQUIRE (not second.loaded_from_cache);
+    REQUIRE (all_ranks_agree(comm,second.loaded_from_cache));
+
+    HorizRemapperData::set_cache_dir("");
+    HorizRemapperData new_ref;
+    new_ref.build(map_file,fine_grid,comm,InterpType::Coarsen);
+    check_same_data(second,new_ref);
+    REQUIRE (not same_view(second.weights,ref.weights));
+
+    // Restore the original map, for the other sections
+    create_remap_file(map_file,ngdofs_tgt,0.5);
+  }
+
+  SECTION ("missing_file_on_one_rank") {
+    HorizRemapperData first;
+    first.build(map_file,fine_grid,comm,InterpType::Coarsen);
+
+    // Only the last rank loses its cache file. Since building the data is
+    // collective, all ranks must rebuild it.
+    comm.barrier();
+    if (comm.rank()==comm.size()-1) {
+      std::remove(cache_file.c_str());
+    }
+    comm.barrier();
+
+    HorizRemapperData second;
+    second.build(map_file,fine_grid,comm,InterpType::Coarsen);
+    REQUIRE (not second.loaded_from_cache);
+    REQUIRE (all_ranks_agree(comm,second.loaded_from_cache));
+    check_same_data(second,ref);
+
+    // The rebuild saved the cache again on all ranks
+    HorizRemapperData third;
+    third.build(map_file,fine_grid,comm,InterpType::Coarsen);
+    REQUIRE (third.loaded_from_cache);
+    check_same_data(third,ref);
+  }
+
+  HorizRemapperData::set_cache_dir("");
+  scorpio::finalize_subsystem();
+}
+
+} // namespace scream
@@ -11,6 +11,8 @@
 #include "share/util/eamxx_universal_constants.hpp"
 #include "physics/share/physics_constants.hpp"
 
+#include <algorithm>
+#include <array>
 #include <filesystem>
 #include <fstream>
 #include <regex>
@@ -60,35 +62,44 @@ void DataInterpolation::run (const util::TimeStamp& ts)
     "  interval length    : " + std::to_string(m_data_interval.length) + "\n"
     "  interpolation coeff: " + std::to_string(alpha) + "\n");
 
-  for (int i=0; i<m_nfields; ++i) {
-    const auto& beg = m_horiz_remapper_beg->get_tgt_field(i);
-    const auto& end = m_horiz_remapper_end->get_tgt_field(i);
-          auto  out = m_vert_remapper->get_src_field(i);
+  if (m_fused_slots.size()>0) {
+    // Interpolate all fields (and src pressure data) at once
+    run_fused_time_interp (alpha);
+  } else {
+    for (int i=0; i<m_nfields; ++i) {
+      const auto& beg = m_horiz_remapper_beg->get_tgt_field(i);
+      const auto& end = m_horiz_remapper_end->get_tgt_field(i);
+            auto  out = m_vert_remapper->get_src_field(i);
 
-    out.deep_copy(beg);
-    out.update(end,alpha,1-alpha);
-  }
+      out.deep_copy(beg);
+      out.update(end,alpha,1-alpha);
+    }
 
-  // For Dynamic3D/Dynamic3D profile we also need to compute the source pressure profile
-  // NOTE: this can't be done in the loop above, since p_data is not a "remapped"
-  //       field in the vertical remapper (also, we need to use ad different ptr)
-  if (m_vr_type==Dynamic3D) {
-    // The pressure field is THE LAST registered in the horiz remappers
-    const auto p_beg = m_horiz_remapper_beg->get_tgt_field(m_nfields);
-    const auto p_end = m_horiz_remapper_end->get_tgt_field(m_nfields);
-
-    auto p = m_helper_pressure_fields["p_data"];
-    p.deep_copy(p_beg);
-    p.update(p_end,alpha,1-alpha);
-  } else if (m_vr_type==Dynamic3DRef) {
-    // The surface pressure field is THE LAST registered in the horiz remappers
-    const auto ps_beg = m_horiz_remapper_beg->get_tgt_field(m_nfields);
-    const auto ps_end = m_horiz_remapper_end->get_tgt_field(m_nfields);
+    // For Dynamic3D/Dynamic3D profile we also need to compute the source pressure profile
+    // NOTE: this can't be done in the loop above, since p_data is not a "remapped"
+    //       field in the vertical remapper (also, we need to use ad different ptr)
+    if (m_vr_type==Dynamic3D) {
+      // The pressure field is THE LAST registered in the horiz remappers
+      const auto p_beg = m_horiz_remapper_beg->get_tgt_field(m_nfields);
+      const auto p_end = m_horiz_remapper_end->get_tgt_field(m_nfields);
+
+      auto p = m_helper_pressure_fields["p_data"];
+      p.deep_copy(p_beg);
+      p.update(p_end,alpha,1-alpha);
+    } else if (m_vr_type==Dynamic3DRef) {
+      // The surface pressure field is THE LAST registered in the horiz remappers
+      const auto ps_beg = m_horiz_remapper_beg->get_tgt_field(m_nfields);
+      const auto ps_end = m_horiz_remapper_end->get_tgt_field(m_nfields);
+
+      auto ps = m_helper_pressure_fields["p_file"];
+      ps.deep_copy(ps_beg);
+      ps.update(ps_end,alpha,1-alpha);
+    }
+  }
 
+  if (m_vr_type==Dynamic3DRef) {
     auto p  = m_helper_pressure_fields["p_data"];
     auto ps = m_helper_pressure_fields["p_file"];
-    ps.deep_copy(ps_beg);
-    ps.update(ps_end,alpha,1-alpha);
 
     // Reconstruct reference p from ps, hyam, and hybm
     using KT = KokkosTypes<DefaultDevice>;
@@ -122,6 +133,151 @@ void DataInterpolation::run (const util::TimeStamp& ts)
   m_vert_remapper->remap_fwd();
 }
 
+void DataInterpolation::setup_fused_time_interp ()
+{
+  // Collect the (beg,end,out) triplets of all the fields to interpolate
+  std::vector<std::array<Field,3>> triplets;
+  for (int i=0; i<m_nfields; ++i) {
+    triplets.push_back({m_horiz_remapper_beg->get_tgt_field(i),
+                        m_horiz_remapper_end->get_tgt_field(i),
+                        m_vert_remapper->get_src_field(i)});
+  }
+  if (m_vr_type==Dynamic3D or m_vr_type==Dynamic3DRef) {
+    const auto& pname = m_vr_type==Dynamic3D ? "p_data" : "p_file";
+    triplets.push_back({m_horiz_remapper_beg->get_tgt_field(m_nfields),
+                        m_horiz_remapper_end->get_tgt_field(m_nfields),
+                        m_helper_pressure_fields.at(pname)});
+  }
+
+  // We can process the raw allocations only if they contain exactly the field data
+  // (modulo padding), with the same layout, and with no fill value to skip
+  auto can_fuse = [](const Field& f, const Field& ref) {
+    const auto& fh = f.get_header();
+    return f.data_type()==get_data_type<Real>() and
+           fh.get_parent()==nullptr and
+           not fh.has_extra_data("mask_value") and
+           fh.get_alloc_properties().get_alloc_size()==ref.get_header().get_alloc_properties().get_alloc_size() and
+           f.get_header().get_identifier().get_layout()==ref.get_header().get_identifier().get_layout();
+  };
+
+  std::vector<FusedInterpSlot> slots;
+  int num_chunks = 0;
+  for (const auto& [beg,end,out] : triplets) {
+    if (not can_fuse(beg,out) or not can_fuse(end,out) or not can_fuse(out,out)) {
+      // Fall back to interpolating one field at a time
+      return;
+    }
+    auto& s = slots.emplace_back();
+    s.a    = beg.get_internal_view_data<const Real>();
+    s.b    = end.get_internal_view_data<const Real>();
+    s.out  = out.get_internal_view_data<Real>();
+    s.size = out.get_header().get_alloc_properties().get_alloc_size() / sizeof(Real);
+    s.first_chunk = num_chunks;
+    num_chunks += (s.size + s_fused_chunk_size - 1) / s_fused_chunk_size;
+  }
+
+  m_fused_slots = decltype(m_fused_slots)("fused_interp_slots",slots.size());
+  auto slots_h = Kokkos::create_mirror_view(m_fused_slots);
+  for (size_t i=0; i<slots.size(); ++i) {
+    slots_h(i) = slots[i];
+  }
+  Kokkos::deep_copy(m_fused_slots,slots_h);
+  m_fused_remapper_a = m_horiz_remapper_beg.get();
+  m_fused_num_chunks = num_chunks;
+}
+
+void DataInterpolation::run_fused_time_interp (const double alpha) const
+{
+  using KT = KokkosTypes<DefaultDevice>;
+  using ExeSpace = typename KT::ExeSpace;
+  using MemberType = typename KT::MemberType;
+  using ESU = ekat::ExeSpaceUtils<ExeSpace>;
+
+  const bool beg_is_a = m_horiz_remapper_beg.get()==m_fused_remapper_a;
+  const auto slots = m_fused_slots;
+  const int nslots = slots.size();
+  const Real a = alpha;
+  const Real b = 1-alpha;
+  constexpr int chunk_size = s_fused_chunk_size;
+
+  // Each team processes one chunk of one field. Same arithmetic as
+  // out.deep_copy(beg) followed by out.update(end,alpha,1-alpha)
+  const auto policy = ESU::get_default_team_policy(m_fused_num_chunks,chunk_size);
+  Kokkos::parallel_for("DataInterpolation::fused_time_interp", policy,
+    KOKKOS_LAMBDA (const MemberType& team) {
+    const int ichunk = team.league_rank();
+
+    // There are few fields, so a linear search is fine
+    int islot = 0;
+    while (islot+1<nslots and slots(islot+1).first_chunk<=ichunk) {
+      ++islot;
+    }
+    const auto& s = slots(islot);
+    const Real* beg = beg_is_a ? s.a : s.b;
+    const Real* end = beg_is_a ? s.b : s.a;
+    const int start = (ichunk-s.first_chunk)*chunk_size;
+    const int n = ekat::impl::min(chunk_size,s.size-start);
+    Kokkos::parallel_for(Kokkos::TeamVectorRange(team,n),
+                         [&](const int k) {
+      const int i = start+k;
+      Real result = beg[i];
+      result *= b;
+      result += a*end[i];
+      s.out[i] = result;
+    });
+  });
+}
+
+std::shared_ptr<const AbstractGrid>
+DataInterpolation::setup_read_only_needed_cols ()
+{
+  using namespace ShortFieldTagsNames;
+  using gid_type = AbstractGrid::gid_type;
+
+  auto p2p_beg = std::dynamic_pointer_cast<RefiningRemapperP2P>(m_horiz_remapper_beg);
+  auto p2p_end = std::dynamic_pointer_cast<RefiningRemapperP2P>(m_horiz_remapper_end);
+  if (p2p_beg==nullptr or p2p_end==nullptr) {
+    return nullptr;
+  }
+
+  // All fields we read must have an overlapped version (i.e., must have the COL dim)
+  const bool read_p = m_vr_type==Dynamic3D or m_vr_type==Dynamic3DRef;
+  const int nread = read_p ? m_nfields+1 : m_nfields;
+  for (int i=0; i<nread; ++i) {
+    for (const auto& p2p : {p2p_beg,p2p_end}) {
+      const auto& f = p2p->get_ov_src_field(i);
+      if (not f.is_allocated() or not f.get_header().get_identifier().get_layout().has_tag(COL)) {
+        return nullptr;
+      }
+    }
+  }
+
+  // The read grid has the same dofs as the overlapped src grid, but the global size
+  // of the unique src grid, so that the ncol dim matches the one in the input files.
+  // NOTE: PIO allows the same offset on multiple ranks when reading
+  const auto src_grid = p2p_beg->get_src_grid();
+  const auto ov_grid  = p2p_beg->get_ov_src_grid();
+  const int nlocal = ov_grid->get_num_local_dofs();
+  auto read_grid = std::make_shared<PointGrid>(ov_grid->name(),nlocal,src_grid->get_num_global_dofs(),
+                                               ov_grid->get_num_vertical_levels(),m_comm);
+  auto ov_gids_h   = ov_grid->get_dofs_gids().get_view<const gid_type*,Host>();
+  auto read_gids_h = read_grid->get_dofs_gids().get_view<gid_type*,Host>();
+  std::copy_n(ov_gids_h.data(),nlocal,read_gids_h.data());
+  read_grid->get_dofs_gids().sync_to_dev();
+
+  // The file offsets are computed from the min gid of the I/O grid. If the first
+  // data col is not needed by any rank, the offsets would be shifted
+  if (read_grid->get_global_min_dof_gid()!=src_grid->get_global_min_dof_gid()) {
+    return nullptr;
+  }
+
+  p2p_beg->set_src_on_ov_grid(true);
+  p2p_end->set_src_on_ov_grid(true);
+  m_src_on_ov_grid = true;
+
+  return read_grid;
+}
+
 void DataInterpolation::shift_data_interval ()
 {
   m_curr_interval_idx.first = m_curr_interval_idx.second;
@@ -136,14 +292,21 @@ void DataInterpolation::
 update_end_fields ()
 {
   // First, set the correct fields in the reader
+  // If reading only the needed cols, read directly in the overlapped src fields
+  auto get_read_field = [&](const int i) -> Field {
+    if (m_src_on_ov_grid) {
+      return std::static_pointer_cast<RefiningRemapperP2P>(m_horiz_remapper_end)->get_ov_src_field(i);
+    }
+    return m_horiz_remapper_end->get_src_field(i);
+  };
   std::vector<Field> fields;
   for (int i=0; i<m_nfields; ++i) {
-    fields.push_back(m_horiz_remapper_end->get_src_field(i));
+    fields.push_back(get_read_field(i));
   }
 
   if (m_vr_type==Dynamic3D or m_vr_type==Dynamic3DRef) {
     // We also need to read the src pressure profile
-    fields.push_back(m_horiz_remapper_end->get_src_field(m_nfields));
+    fields.push_back(get_read_field(m_nfields));
   }
   m_reader->set_fields(fields);
 
@@ -164,15 +327,25 @@ init_data_interval (const util::TimeStamp& t0)
   EKAT_REQUIRE_MSG (m_vert_remapper!=nullptr,
       "[DataInterpolation] Error! Cannot call 'init_data_interval' until after remappers creation.\n");
 
-  register_fields_in_remappers ();
+  // If called again (e.g., to restart the interpolation from an earlier time),
+  // the remappers and the reader are already set up, and can be reused
+  if (not m_data_initialized) {
+    register_fields_in_remappers ();
 
-  // Create a bare reader. Fields and filename are set inside the update_end_fields call
-  strvec_t fnames;
-  for (auto f : m_fields) {
-    fnames.push_back(f.name());
-  }
+    // Create a bare reader. Fields and filename are set inside the update_end_fields call
+    strvec_t fnames;
+    for (auto f : m_fields) {
+      fnames.push_back(f.name());
+    }
 
-  m_reader = std::make_shared<AtmosphereInput>(fnames,m_horiz_remapper_beg->get_src_grid());
+    auto read_grid = m_read_only_needed_cols ? setup_read_only_needed_cols() : nullptr;
+    if (read_grid) {
+      // The read grid has repeated gids across ranks, so it cannot pass the I/O grid checks
+      m_reader = std::make_shared<AtmosphereInput>(fnames,read_grid,true);
+    } else {
+      m_reader = std::make_shared<AtmosphereInput>(fnames,m_horiz_remapper_beg->get_src_grid());
+    }
+  }
 
   // Loop over all stored time slices to find an interval that contains t0
   auto t0_interval = m_time_database.find_interval(t0);
@@ -187,6 +360,10 @@ init_data_interval (const util::TimeStamp& t0)
   update_end_fields ();
   shift_data_interval ();
 
+  if (not m_data_initialized) {
+    setup_fused_time_interp ();
+  }
+
   m_data_initialized = true;
 }
 
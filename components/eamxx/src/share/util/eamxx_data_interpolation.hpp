@@ -48,6 +48,13 @@ public:
 
   void toggle_debug_output (bool enable_dbg_output) { m_dbg_output = enable_dbg_output; }
 
+  // If enabled (and the horiz remap is a RefiningRemapperP2P), each rank reads from file
+  // only the data cols needed by its own tgt cols, skipping the MPI redistribution
+  // of the data at every slice update. Must be called before init_data_interval.
+  void toggle_read_only_needed_cols (bool enable) { m_read_only_needed_cols = enable; }
+  // Whether the needed-cols read is actually in use (it may not be possible, see above)
+  bool reads_only_needed_cols () const { return m_src_on_ov_grid; }
+
   void setup_time_database (const strvec_t& input_files,
                             const util::TimeLine timeline,
                             const util::TimeStamp& ref_ts = util::TimeStamp());
@@ -68,15 +75,35 @@ public:
 
   std::shared_ptr<AbstractGrid> get_grid_after_hremap () const { return m_grid_after_hremap; }
 
+  // CUDA requires the parent fcn of a KOKKOS_LAMBDA to have public access
+  void run_fused_time_interp (const double alpha) const;
+
 protected:
 
   void shift_data_interval ();
   void update_end_fields ();
 
+  // Time interpolation of all fields (and src pressure data) in a single kernel
+  void setup_fused_time_interp ();
+
+  // Returns the grid to read only the needed cols with (or nullptr, if not possible)
+  std::shared_ptr<const AbstractGrid> setup_read_only_needed_cols ();
+
   int get_input_files_dimlen (const std::string& dimname) const;
 
   // ----------- Internal data types ---------- //
 
+  // Data of one field for the fused time interpolation. Since the beg/end
+  // horiz remappers are swapped when the data interval shifts, we store the
+  // tgt fields data of the two remappers, and pick beg/end at runtime.
+  struct FusedInterpSlot {
+    const Real* a;    // Tgt field data in m_fused_remapper_a
+    const Real* b;    // Tgt field data in the other horiz remapper
+    Real*       out;  // Src field data in the vert remapper (or pressure helper)
+    int         size;
+    int         first_chunk;
+  };
+
   struct DataSlice {
     util::TimeStamp time;
     std::string     filename;
@@ -117,6 +144,13 @@ protected:
   // versions of certain perssure fields. Store them here for convenient access
   std::map<std::string,Field>     m_helper_pressure_fields;
 
+  // Fused time interpolation data. If m_fused_slots is empty (e.g., some field
+  // is a subfield or has a mask value), we interpolate one field at a time
+  KokkosTypes<DefaultDevice>::view_1d<FusedInterpSlot> m_fused_slots;
+  const AbstractRemapper* m_fused_remapper_a = nullptr;
+  int                     m_fused_num_chunks = 0;
+  static constexpr int    s_fused_chunk_size = 4096;
+
   VRemapType            m_vr_type;
   int                   m_nfields;
 
@@ -132,6 +166,9 @@ protected:
   bool                  m_data_initialized  = false;
 
   bool m_dbg_output = false;
+
+  bool m_read_only_needed_cols = false;
+  bool m_src_on_ov_grid        = false;
 };
 
 } // namespace scream
@@ -0,0 +1,76 @@
+#include <catch2/catch.hpp>
+
+#include "physics/ml_correction/eamxx_ml_correction_native_model.hpp"
+
+#include <fstream>
+
+namespace scream {
+TEST_CASE("ml_correction-native-model", "") {
+  using Model = MLCorrectionNativeModel;
+
+  // A 2-layer network on 3 input features: T_mid (2 levels) and lat.
+  //   h = relu(W1*xn + b1), y = W2*h + b2, with xn=(x-mean)/std
+  const std::string fname = "ml_correction_native_model_test.txt";
+  {
+    std::ofstream ofs(fname);
+    ofs << "eamxx_ml_native_model 1\n"
+        << "inputs 2\n"
+        << "T_mid 2\n"
+        << "lat 1\n"
+        << "input_normalization\n"
+        << "1 2\n"
+        << "0 1\n"
+        << "0 1\n"
+        << "layers 2\n"
+        << "3 2 relu\n"
+        << "1 0 0\n"
+        << "0 1 -1\n"
+        << "0 0.5\n"
+        << "2 2 linear\n"
+        << "1 1\n"
+        << "2 -1\n"
+        << "0 1\n"
+        << "outputs 1\n"
+        << "dQ1 2\n"
+        << "output_denormalization\n"
+        << "0 1\n"
+        << "1 10\n";
+  }
+
+  Model model(fname);
+  REQUIRE (model.num_input_features()==3);
+  REQUIRE (model.num_output_features()==2);
+  REQUIRE (model.find_input("lat")!=nullptr);
+  REQUIRE (model.find_input("lat")->offset==2);
+  REQUIRE (model.find_input("qv")==nullptr);
+  REQUIRE (model.find_output("dQ1")->size==2);
+
+  // More columns than the team block size, to exercise partial blocks
+  const int ncol = 11;
+  Model::view_2d<Real> x("x",ncol,3), y("y",ncol,2);
+  auto x_h = Kokkos::create_mirror_view(x);
+  for (int i=0; i<ncol; ++i) {
+    x_h(i,0) = 1 + 0.5*i;
+    x_h(i,1) = 0.25*i - 1;
+    x_h(i,2) = 0.1*i;
+  }
+  Kokkos::deep_copy(x,x_h);
+
+  model.predict(x,y);
+
+  auto y_h = Kokkos::create_mirror_view(y);
+  Kokkos::deep_copy(y_h,y);
+  for (int i=0; i<ncol; ++i) {
+    const Real xn0 = (x_h(i,0)-1)/2;
+    const Real xn1 = x_h(i,1);
+    const Real xn2 = x_h(i,2);
+    const Real h0 = std::max(Real(0),xn0);
+    const Real h1 = std::max(Real(0),xn1-xn2+Real(0.5));
+    const Real y0 = h0+h1;
+    const Real y1 = 2*h0-h1+1;
+    REQUIRE (y_h(i,0)==Approx(y0));
+    REQUIRE (y_h(i,1)==Approx(y1*10+1));
+  }
+}
+
+} // namespace scream
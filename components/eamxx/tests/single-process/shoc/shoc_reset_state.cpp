@@ -0,0 +1,115 @@
+#include <catch2/catch.hpp>
+
+#include "control/atmosphere_driver.hpp"
+#include "diagnostics/register_diagnostics.hpp"
+#include "physics/register_physics.hpp"
+
+#include "share/atm_process/atmosphere_process.hpp"
+#include "share/grid/mesh_free_grids_manager.hpp"
+#include "share/field/field_utils.hpp"
+
+#include "ekat/ekat_parse_yaml_file.hpp"
+
+#include <map>
+
+namespace scream {
+
+// A process that does nothing, and cannot reset its state
+class NoReset : public AtmosphereProcess
+{
+public:
+  NoReset (const ekat::Comm& comm, const ekat::ParameterList& params)
+   : AtmosphereProcess(comm,params)
+  {
+    // Nothing to do here
+  }
+
+  AtmosphereProcessType type () const override { return AtmosphereProcessType::Physics; }
+  std::string name () const override { return "no_reset"; }
+
+  void set_grids (const std::shared_ptr<const GridsManager> /* grids_manager */) override {}
+
+  bool supports_state_reset () const override { return false; }
+
+protected:
+  void initialize_impl (const RunType /* run_type */) override {}
+  void run_impl (const double /* dt */) override {}
+  void finalize_impl () override {}
+};
+
+// Deep copies of the fields computed by the atm procs
+std::map<std::string,Field>
+copy_computed_fields (const control::AtmosphereDriver& ad)
+{
+  std::map<std::string,Field> copies;
+  for (const auto& f : ad.get_atm_processes()->get_fields_out()) {
+    copies.emplace(f.name(),f.clone());
+  }
+  return copies;
+}
+
+TEST_CASE("shoc-reset-state", "") {
+  using namespace scream::control;
+
+  ekat::Comm atm_comm (MPI_COMM_WORLD);
+
+  // Load ad parameter list
+  ekat::ParameterList ad_params("Atmosphere Driver");
+  parse_yaml_file("reset_input.yaml",ad_params);
+
+  // Time stepping parameters
+  const auto& ts     = ad_params.sublist("time_stepping");
+  const auto  dt     = ts.get<int>("time_step");
+  const auto  nsteps = ts.get<int>("number_of_steps");
+  const auto  t0     = util::str_to_time_stamp(ts.get<std::string>("run_t0"));
+
+  // Register all atm procs, grids manager, and diagnostics in the respective factories
+  register_physics();
+  register_diagnostics();
+  register_mesh_free_grids_manager();
+  AtmosphereProcessFactory::instance().register_product("NoReset",&create_atmosphere_process<NoReset>);
+
+  SECTION ("bfb_rerun") {
+    AtmosphereDriver ad;
+    ad.initialize(atm_comm,ad_params,t0);
+    for (int i=0; i<nsteps; ++i) {
+      ad.run(dt);
+    }
+    const auto first_run = copy_computed_fields(ad);
+
+    // Same ICs, same start time: the second run must be BFB with the first
+    ad.reset_state(t0);
+    REQUIRE (ad.get_atm_time_stamp()==t0);
+    for (const auto& f : ad.get_atm_processes()->get_fields_out()) {
+      REQUIRE (f.get_header().get_tracking().get_time_stamp()==t0);
+    }
+
+    for (int i=0; i<nsteps; ++i) {
+      ad.run(dt);
+    }
+    const auto second_run = copy_computed_fields(ad);
+
+    REQUIRE (first_run.size()==second_run.size());
+    for (const auto& it : first_run) {
+      INFO ("field: " + it.first);
+      REQUIRE (views_are_equal(it.second,second_run.at(it.first)));
+    }
+    ad.finalize();
+  }
+
+  SECTION ("unsupported_reset") {
+    // Add a process that cannot reset its state
+    auto params = ad_params;
+    auto& procs = params.sublist("atmosphere_processes");
+    procs.set<std::vector<std::string>>("atm_procs_list",{"shoc","no_reset"});
+    procs.sublist("no_reset").set<std::string>("type","NoReset");
+
+    AtmosphereDriver ad;
+    ad.initialize(atm_comm,params,t0);
+    ad.run(dt);
+    REQUIRE_THROWS (ad.reset_state(t0));
+    ad.finalize();
+  }
+}
+
+} // namespace scream
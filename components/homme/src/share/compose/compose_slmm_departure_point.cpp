@@ -156,6 +156,54 @@ Int test_fill_perim (const LocalMesh<ES>& m, const Int& tgt_ic) {
 }
 } // namespace nearest_point
 
+// On a refined 3x3 patch of cells, check that get_src_cell with a previous
+// source cell returns the same cell as the full search for points at and near
+// cell edges.
+static Int test_get_src_cell_prev () {
+  Int nerr = 0;
+  static const Real hs[] = { 1e-2, 1e-4, 1e-6 };
+  static const Real alphas[] = { 0, 1e-12, 1e-9, 1e-6, 1e-3, 0.5,
+                                 1-1e-3, 1-1e-6, 1-1e-9, 1-1e-12, 1 };
+  static const int nalphas = sizeof(alphas)/sizeof(*alphas);
+  for (const Real h : hs) {
+    LocalMesh<ko::MachineTraits::HES> m;
+    m.geometry = Geometry::Type::sphere;
+    m.p = decltype(m.p)("p", 16);
+    m.e = decltype(m.e)("e", 9, 4);
+    for (Int j = 0; j < 4; ++j)
+      for (Int i = 0; i < 4; ++i) {
+        Real* const p = &m.p(4*j + i, 0);
+        p[0] = 1; p[1] = (i - 1.5)*h; p[2] = (j - 1.5)*h;
+        siqk::SphereGeometry::normalize(p);
+      }
+    for (Int j = 0; j < 3; ++j)
+      for (Int i = 0; i < 3; ++i) {
+        const Int ic = 3*j + i, k = 4*j + i;
+        m.e(ic,0) = k; m.e(ic,1) = k+1; m.e(ic,2) = k+5; m.e(ic,3) = k+4;
+      }
+    m.tgt_elem = 4;
+    fill_normals(m);
+    for (Int ic = 0; ic < 9; ++ic) {
+      const auto cell = slice(m.e, ic);
+      for (Int i = 0; i < nalphas; ++i)
+        for (Int j = 0; j < nalphas; ++j) {
+          const Real a = alphas[i], oma = 1-a, b = alphas[j], omb = 1-b;
+          Real v[3];
+          for (Int d = 0; d < 3; ++d)
+            v[d] = (  b*(a*m.p(cell[0], d) + oma*m.p(cell[1], d)) +
+                    omb*(a*m.p(cell[3], d) + oma*m.p(cell[2], d)));
+          siqk::SphereGeometry::normalize(v);
+          const Int src = get_src_cell(m, v, m.tgt_elem);
+          if (src == -1) ++nerr;
+          if (a == 0.5 && b == 0.5 && src != ic) ++nerr;
+          for (Int prev = -1; prev < 9; ++prev)
+            if (get_src_cell(m, v, m.tgt_elem, prev) != src) ++nerr;
+        }
+    }
+  }
+  return nerr;
+}
+
 Int unittest (LocalMesh<ko::MachineTraits::HES>& m, const Int tgt_elem,
               const Real length_scale) {
   Int nerr = 0, ne = 0;
@@ -180,6 +228,9 @@ Int unittest (LocalMesh<ko::MachineTraits::HES>& m, const Int tgt_elem,
   }
   if (ne) pr("slmm::unittest: get_src_cell failed");
   nerr += ne;
+  ne = test_get_src_cell_prev();
+  if (ne) pr("slmm::unittest: test_get_src_cell_prev failed");
+  nerr += ne;
   ne = nearest_point::test_canpoa(true);
   if (ne) pr("slmm::unittest: test_canpoa sphere failed");
   nerr += ne;
@@ -128,6 +128,19 @@ bool is_inside (const LocalMesh<ES>& m,
   return inside;
 }
 
+// Length of the first edge of cell ic, a representative edge length for the
+// cell.
+template <typename ES> SLMM_KIF
+Real calc_edge_length (const LocalMesh<ES>& m, const Int& ic) {
+  using slmm::slice;
+  const auto cell = slice(m.e, ic);
+  Real d[3];
+  siqk::SphereGeometry::axpbyz( 1, slice(m.p, cell[1]),
+                               -1, slice(m.p, cell[0]),
+                               d);
+  return std::sqrt(siqk::SphereGeometry::norm2(d));
+}
+
 // Both cubed_sphere_map=0 and cubed_sphere_map=2 can use this method.
 // (cubed_sphere_map=1 is not impl'ed in Homme.)
 //   This method is natural for cubed_sphere_map=2, so RRM works automatically.
@@ -148,18 +161,11 @@ int get_src_cell (const LocalMesh<ES>& m, // Local mesh.
   for (Int trial = 0; trial < 3; ++trial) {
     if (trial > 0) {
       if (trial == 1) {
-        using slmm::slice;
         // If !inside in the first sweep, pad each cell. Recall we're operating
         // on the unit sphere, so we don't have to worry about a radius in the
         // following.
         //   Get a representative edge length.
-        const int ic = my_ic == -1 ? 0 : my_ic;
-        const auto cell = slice(m.e, ic);
-        Real d[3];
-        siqk::SphereGeometry::axpbyz( 1, slice(m.p, cell[1]),
-                                     -1, slice(m.p, cell[0]),
-                                     d);
-        const Real L = std::sqrt(siqk::SphereGeometry::norm2(d));
+        const Real L = calc_edge_length(m, my_ic == -1 ? 0 : my_ic);
         // We can expect to lose approx. -log10(L) digits due to cancellation in
         // the formation of the edge normal and in dot_c_amb. Multiply by 100
         // for a little extra padding.
@@ -180,6 +186,30 @@ int get_src_cell (const LocalMesh<ES>& m, // Local mesh.
   return -1;
 }
 
+// Same as get_src_cell, but first try prev_ic, the cell that contained the
+// point the previous time it was located (e.g., at the previous trajectory
+// substep). Departure points move by a fraction of a cell per substep, so
+// most stay in the same source cell, and the search over the local mesh can
+// be skipped. As in get_src_cell, my_ic is checked first. prev_ic is then
+// accepted only if v is inside it by a margin; then no other cell can contain
+// v, and the result is the same as get_src_cell's.
+template <typename ES> SLMM_KF
+int get_src_cell (const LocalMesh<ES>& m, // Local mesh.
+                  const Real* v, // 3D Cartesian point.
+                  const Int my_ic, // Target cell in the local mesh.
+                  const Int prev_ic) { // Source cell at the previous call.
+  using slmm::len;
+  if (prev_ic >= 0 && prev_ic < len(m.e) && prev_ic != my_ic) {
+    if (my_ic != -1 && is_inside(m, v, 0, my_ic)) return my_ic;
+    // The margin scales with 1/L like get_src_cell's trial-1 tolerance, with
+    // another factor of 10 of padding, so it remains valid on refined meshes.
+    const Real margin = (1e3 * ko::NumericTraits<Real>::epsilon() /
+                         calc_edge_length(m, prev_ic));
+    if (is_inside(m, v, -margin, prev_ic)) return prev_ic;
+  }
+  return get_src_cell(m, v, my_ic);
+}
+
 namespace nearest_point {
 /* Get external segments in preproc step.
    Get approximate nearest point in each segment.
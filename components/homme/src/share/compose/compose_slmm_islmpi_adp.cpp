@@ -93,7 +93,9 @@ void analyze_dep_points (IslMpi<MT>& cm, const Int& nets, const Int& nete,
       const auto& mesh = local_meshes(tci);
       const auto tgt_idx = mesh.tgt_elem;
       auto& ed = ed_d(tci);
-      Int sci = slmm::get_src_cell(mesh, &dep_points(tci,lev,k,0), tgt_idx);
+      // Use the source cell found at the previous call as a first guess.
+      Int sci = slmm::get_src_cell(mesh, &dep_points(tci,lev,k,0), tgt_idx,
+                                   ed.src(lev,k));
       if (sci == -1) {
         const bool npp = slmm::Advecter<MT>::nearest_point_permitted(
           nearest_point_permitted_lev_bdy, lev);
@@ -166,7 +168,9 @@ void analyze_dep_points (IslMpi<MT>& cm, const Int& nets, const Int& nete,
       const auto& mesh = local_meshes(tci);
       const auto tgt_idx = mesh.tgt_elem;
       auto& ed = ed_d(tci);
-      Int sci = slmm::get_src_cell(mesh, &dep_points(tci,lev,k,0), tgt_idx);
+      // Use the source cell found at the previous call as a first guess.
+      Int sci = slmm::get_src_cell(mesh, &dep_points(tci,lev,k,0), tgt_idx,
+                                   ed.src(lev,k));
       if (sci == -1) {
         const bool npp = slmm::Advecter<MT>::nearest_point_permitted(
           nearest_point_permitted_lev_bdy, lev);
@@ -181,6 +181,7 @@ void velocity_solver_set_grid_data(int const* _nCells_F, int const* _nEdges_F,
 
   thicknessOnCells.resize(nCellsSolve_F);
 
+  clearExchangePlans();
   sendCellsList_F = new exchangeList_Type(unpackMpiArray(sendCellsArray_F));
   recvCellsList_F = new exchangeList_Type(unpackMpiArray(recvCellsArray_F));
   sendEdgesList_F = new exchangeList_Type(unpackMpiArray(sendEdgesArray_F));
@@ -333,6 +334,7 @@ void velocity_solver_export_fo_velocity() {
 
 void velocity_solver_finalize() {
   velocity_solver_finalize__();
+  clearExchangePlans();
   delete sendCellsList_F;
   delete recvCellsList_F;
   delete sendEdgesList_F;
@@ -358,6 +360,9 @@ void velocity_solver_compute_2d_grid(int const* _verticesMask_F, int const* _cel
   verticesMask_F = _verticesMask_F;
   dirichletCellsMask_F = _dirichletCellsMask_F;
 
+  // The reverse exchange lists are rebuilt below, so cached plans are stale
+  clearExchangePlans();
+
   MPI_Comm_size(comm, &numProcs);
   MPI_Comm_rank(comm, &me);
   std::vector<int> partialOffset(numProcs + 1), globalOffsetTriangles(
@@ -1425,146 +1430,125 @@ exchangeList_Type unpackMpiArray(int const * array) {
   return list;
 }
 
-void allToAll(std::vector<int>& field, int const * sendArray,
-    int const * recvArray, int fieldDim) {
-  exchangeList_Type sendList, recvList;
-
-  //unpack sendArray and build the sendList class
-  for (int i(1), procID, size; i < sendArray[0]; i += size) {
-    procID = sendArray[i++];
-    size = sendArray[i++];
-    sendList.push_back(
-        exchange(procID, &sendArray[i], &sendArray[i + size], fieldDim));
-  }
-
-  //unpack recvArray and build the recvList class
-  for (int i(1), procID, size; i < recvArray[0]; i += size) {
-    procID = recvArray[i++];
-    size = recvArray[i++];
-    recvList.push_back(
-        exchange(procID, &recvArray[i], &recvArray[i + size], fieldDim));
-  }
+template <typename T> MPI_Datatype mpiDatatype();
+template <> MPI_Datatype mpiDatatype<int>() { return MPI_INT; }
+template <> MPI_Datatype mpiDatatype<double>() { return MPI_DOUBLE; }
 
+template <typename T>
+exchangePlan<T>::exchangePlan(exchangeList_Type const* sendList,
+    exchangeList_Type const* recvList, int _fieldDim) :
+    fieldDim(_fieldDim), nRecvs(0) {
   int me;
   MPI_Comm_rank(comm, &me);
 
-  exchangeList_Type::iterator it;
-  for (it = recvList.begin(); it != recvList.end(); ++it) {
+  std::vector<int> sendProcs, recvProcs;
+  recvOffsets.push_back(0);
+  for (exchangeList_Type::const_iterator it = recvList->begin(); it != recvList->end(); ++it) {
     if (it->procID == me)
       continue;
-    MPI_Irecv(&(it->buffer[0]), it->buffer.size(), MPI_INT, it->procID,
-        it->procID, comm, &it->reqID);
+    recvProcs.push_back(it->procID);
+    recvIndices.insert(recvIndices.end(), it->vec.begin(), it->vec.end());
+    recvOffsets.push_back(recvIndices.size());
   }
-
-  for (it = sendList.begin(); it != sendList.end(); ++it) {
+  sendOffsets.push_back(0);
+  for (exchangeList_Type::const_iterator it = sendList->begin(); it != sendList->end(); ++it) {
     if (it->procID == me)
       continue;
-    for (ID i = 0; i < it->vec.size(); i++)
-      for (int iComp = 0; iComp < fieldDim; iComp++)
-        it->buffer[fieldDim * i + iComp] = field[fieldDim * it->vec[i] + iComp];
-
-    MPI_Isend(&(it->buffer[0]), it->buffer.size(), MPI_INT, it->procID, me,
-        comm, &it->reqID);
+    sendProcs.push_back(it->procID);
+    sendIndices.insert(sendIndices.end(), it->vec.begin(), it->vec.end());
+    sendOffsets.push_back(sendIndices.size());
   }
 
-  for (it = recvList.begin(); it != recvList.end(); ++it) {
-    if (it->procID == me)
-      continue;
-    MPI_Wait(&it->reqID, MPI_STATUS_IGNORE);
-
-    for (int i = 0; i < int(it->vec.size()); i++)
-      for (int iComp = 0; iComp < fieldDim; iComp++)
-        field[fieldDim * it->vec[i] + iComp] = it->buffer[fieldDim * i + iComp];
+  // One message per neighbor carrying all the field components
+  recvBuffer.resize(fieldDim * recvIndices.size());
+  sendBuffer.resize(fieldDim * sendIndices.size());
+  nRecvs = recvProcs.size();
+  requests.resize(recvProcs.size() + sendProcs.size());
+  for (int p = 0; p < int(recvProcs.size()); p++) {
+    int size = fieldDim * (recvOffsets[p + 1] - recvOffsets[p]);
+    MPI_Recv_init(recvBuffer.data() + fieldDim * recvOffsets[p], size, mpiDatatype<T>(),
+        recvProcs[p], recvProcs[p], comm, &requests[p]);
   }
-
-  for (it = sendList.begin(); it != sendList.end(); ++it) {
-    if (it->procID == me)
-      continue;
-    MPI_Wait(&it->reqID, MPI_STATUS_IGNORE);
+  for (int p = 0; p < int(sendProcs.size()); p++) {
+    int size = fieldDim * (sendOffsets[p + 1] - sendOffsets[p]);
+    MPI_Send_init(sendBuffer.data() + fieldDim * sendOffsets[p], size, mpiDatatype<T>(),
+        sendProcs[p], me, comm, &requests[nRecvs + p]);
   }
 }
 
-void allToAll(std::vector<int>& field, exchangeList_Type const * sendList,
-    exchangeList_Type const * recvList, int fieldDim) {
-  int me;
-  MPI_Comm_rank(comm, &me);
+template <typename T>
+exchangePlan<T>::~exchangePlan() {
+  for (int i = 0; i < int(requests.size()); i++)
+    MPI_Request_free(&requests[i]);
+}
 
-  for (int iComp = 0; iComp < fieldDim; iComp++) {
-    exchangeList_Type::const_iterator it;
-    for (it = recvList->begin(); it != recvList->end(); ++it) {
-      if (it->procID == me)
-        continue;
-      MPI_Irecv(&(it->buffer[0]), it->buffer.size(), MPI_INT, it->procID,
-          it->procID, comm, &it->reqID);
-    }
+template <typename T>
+void exchangePlan<T>::run(T* field) {
+  if (requests.empty())
+    return;
 
-    for (it = sendList->begin(); it != sendList->end(); ++it) {
-      if (it->procID == me)
-        continue;
-      for (ID i = 0; i < it->vec.size(); i++)
-        it->buffer[i] = field[fieldDim * it->vec[i] + iComp];
+  // Post the receives before packing so they overlap with the packing
+  if (nRecvs > 0)
+    MPI_Startall(nRecvs, requests.data());
 
-      MPI_Isend(&(it->buffer[0]), it->buffer.size(), MPI_INT, it->procID, me,
-          comm, &it->reqID);
-    }
+  for (int i = 0; i < int(sendIndices.size()); i++)
+    for (int iComp = 0; iComp < fieldDim; iComp++)
+      sendBuffer[fieldDim * i + iComp] = field[fieldDim * sendIndices[i] + iComp];
 
-    for (it = recvList->begin(); it != recvList->end(); ++it) {
-      if (it->procID == me)
-        continue;
-      MPI_Wait(&it->reqID, MPI_STATUS_IGNORE);
+  if (int(requests.size()) > nRecvs)
+    MPI_Startall(requests.size() - nRecvs, requests.data() + nRecvs);
 
-      for (int i = 0; i < int(it->vec.size()); i++)
-        field[fieldDim * it->vec[i] + iComp] = it->buffer[i];
-    }
+  MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
 
-    for (it = sendList->begin(); it != sendList->end(); ++it) {
-      if (it->procID == me)
-        continue;
-      MPI_Wait(&it->reqID, MPI_STATUS_IGNORE);
-    }
-  }
+  for (int i = 0; i < int(recvIndices.size()); i++)
+    for (int iComp = 0; iComp < fieldDim; iComp++)
+      field[fieldDim * recvIndices[i] + iComp] = recvBuffer[fieldDim * i + iComp];
 }
 
-void allToAll(double* field, exchangeList_Type const * sendList,
-    exchangeList_Type const * recvList, int fieldDim) {
-  int me;
-  MPI_Comm_rank(comm, &me);
-
-  for (int iComp = 0; iComp < fieldDim; iComp++) {
-    exchangeList_Type::const_iterator it;
-
-    for (it = recvList->begin(); it != recvList->end(); ++it) {
-      if (it->procID == me)
-        continue;
-      MPI_Irecv(&(it->doubleBuffer[0]), it->doubleBuffer.size(), MPI_DOUBLE,
-          it->procID, it->procID, comm, &it->reqID);
-    }
+// Plans are keyed by the lists they were built from and the field dimension
+typedef std::tuple<void const*, void const*, int> exchangePlanKey;
+std::map<exchangePlanKey, std::unique_ptr<exchangePlan<int> > > intExchangePlans;
+std::map<exchangePlanKey, std::unique_ptr<exchangePlan<double> > > doubleExchangePlans;
+
+// Exchange lists unpacked from packed MPAS send/recv arrays
+std::map<std::pair<int const*, int const*>,
+    std::pair<exchangeList_Type, exchangeList_Type> > unpackedExchangeLists;
+
+template <typename T>
+exchangePlan<T>& getExchangePlan(std::map<exchangePlanKey, std::unique_ptr<exchangePlan<T> > >& plans,
+    exchangeList_Type const * sendList, exchangeList_Type const * recvList, int fieldDim) {
+  std::unique_ptr<exchangePlan<T> >& plan = plans[exchangePlanKey(sendList, recvList, fieldDim)];
+  if (!plan)
+    plan.reset(new exchangePlan<T>(sendList, recvList, fieldDim));
+  return *plan;
+}
 
-    for (it = sendList->begin(); it != sendList->end(); ++it) {
-      if (it->procID == me)
-        continue;
-      for (ID i = 0; i < it->vec.size(); i++)
-        it->doubleBuffer[i] = field[fieldDim * it->vec[i] + iComp];
+void clearExchangePlans() {
+  intExchangePlans.clear();
+  doubleExchangePlans.clear();
+  unpackedExchangeLists.clear();
+}
 
-      MPI_Isend(&(it->doubleBuffer[0]), it->doubleBuffer.size(), MPI_DOUBLE,
-          it->procID, me, comm, &it->reqID);
-    }
+void allToAll(std::vector<int>& field, int const * sendArray,
+    int const * recvArray, int fieldDim) {
+  std::pair<exchangeList_Type, exchangeList_Type>& lists =
+      unpackedExchangeLists[std::make_pair(sendArray, recvArray)];
+  if (lists.first.empty() && lists.second.empty()) {
+    lists.first = unpackMpiArray(sendArray);
+    lists.second = unpackMpiArray(recvArray);
+  }
 
-    for (it = recvList->begin(); it != recvList->end(); ++it) {
-      if (it->procID == me)
-        continue;
-      MPI_Wait(&it->reqID, MPI_STATUS_IGNORE);
+  allToAll(field, &lists.first, &lists.second, fieldDim);
+}
 
-      for (int i = 0; i < int(it->vec.size()); i++)
-        field[fieldDim * it->vec[i] + iComp] = it->doubleBuffer[i];
-    }
+void allToAll(std::vector<int>& field, exchangeList_Type const * sendList,
+    exchangeList_Type const * recvList, int fieldDim) {
+  getExchangePlan(intExchangePlans, sendList, recvList, fieldDim).run(field.data());
+}
 
-    for (it = sendList->begin(); it != sendList->end(); ++it) {
-      if (it->procID == me)
-        continue;
-      MPI_Wait(&it->reqID, MPI_STATUS_IGNORE);
-    }
-  }
+void allToAll(double* field, exchangeList_Type const * sendList,
+    exchangeList_Type const * recvList, int fieldDim) {
+  getExchangePlan(doubleExchangePlans, sendList, recvList, fieldDim).run(field);
 }
 
 int initialize_iceProblem(int nTriangles) {
@@ -21,6 +21,8 @@ distributed with this code, or at http://mpas-dev.github.io/license.html
 #include <limits>
 #include <cmath>
 #include <map>
+#include <memory>
+#include <tuple>
 
 #ifndef MPASLI_EXTERNAL_INTERFACE_DISABLE_MANGLING
 #define velocity_solver_init_mpi velocity_solver_init_mpi_
@@ -57,6 +59,32 @@ struct exchange {
 
 typedef std::list<exchange> exchangeList_Type;
 
+// Persistent communication plan for one (sendList, recvList, fieldDim)
+// exchange. The packed buffers and the persistent MPI requests are created
+// once and reused by every allToAll call on the same lists, until the mesh
+// changes and clearExchangePlans is called.
+template <typename T>
+struct exchangePlan {
+  int fieldDim;
+  int nRecvs;                    // requests [0, nRecvs) are receives, the rest sends
+  std::vector<int> sendOffsets;  // CSR offsets of each neighbor into sendIndices
+  std::vector<int> sendIndices;  // local entities packed for each neighbor
+  std::vector<int> recvOffsets;
+  std::vector<int> recvIndices;
+  std::vector<T> sendBuffer;
+  std::vector<T> recvBuffer;
+  std::vector<MPI_Request> requests;
+
+  exchangePlan(exchangeList_Type const* sendList, exchangeList_Type const* recvList,
+      int _fieldDim);
+  ~exchangePlan();
+
+  exchangePlan(const exchangePlan&) = delete;
+  exchangePlan& operator=(const exchangePlan&) = delete;
+
+  void run(T* field);
+};
+
 typedef unsigned int ID;
 typedef unsigned int UInt;
 const ID NotAnId = std::numeric_limits<int>::max();
@@ -262,6 +290,10 @@ void allToAll(std::vector<int>& field, exchangeList_Type const* sendList,
 void allToAll(double* field, exchangeList_Type const* sendList,
     exchangeList_Type const* recvList, int fieldDim = 1);
 
+// Frees all cached exchange plans. Must be called whenever the exchange
+// lists change (new grid data, or a new 2d grid from the ice mask).
+void clearExchangePlans();
+
 void procsSharingVertex(const int vertex, std::vector<int>& procIds);
 
 bool belongToTria(double const* x, double const* t, double bcoords[3], double eps = 1e-3);
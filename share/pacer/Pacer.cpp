@@ -10,6 +10,10 @@
 #include <mpi.h>
 #include <gptl.h>
 #include <iostream>
+#include <fstream>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 #define PACER_CHECK_INIT() {\
     if (!IsInitialized) { \
@@ -32,6 +36,40 @@ extern "C" {
     extern int GPTLis_initialized(void);
 }
 
+/// Number of threads with handle and trace storage
+static int MaxThreads = 1;
+
+/// Thread index of the caller
+static inline int getThreadId(void) {
+#ifdef _OPENMP
+    return omp_get_thread_num();
+#else
+    return 0;
+#endif
+}
+
+/// Checks that Handle was returned by registerTimer and that
+/// per-thread storage exists for Thread
+static bool isValidHandle(Pacer::TimerHandle Handle, int Thread) {
+    if (Handle < 0 || Handle >= static_cast<int>(Pacer::HandleNames.size())) {
+        std::cerr << "[ERROR] Pacer: Invalid timer handle: " << Handle << std::endl;
+        return false;
+    }
+    if (Thread >= MaxThreads) {
+        std::cerr << "[ERROR] Pacer: Thread " << Thread << " exceeds the "
+            << MaxThreads << " threads available at initialization." << std::endl;
+        return false;
+    }
+    return true;
+}
+
+/// Records a begin or end event in the ring buffer of Thread
+static inline void recordTraceEvent(Pacer::TimerHandle Handle, int Thread, bool IsBegin) {
+    size_t &Count = Pacer::ThreadTraceCounts[Thread];
+    Pacer::ThreadTraces[Thread][Count % Pacer::TraceCapacity] = {Handle, IsBegin, MPI_Wtime()};
+    Count++;
+}
+
 /// Check if Pacer is initialized
 /// Returns true if initialized
 inline bool Pacer::isInitialized(void){
@@ -60,6 +98,13 @@ bool Pacer::initialize(MPI_Comm InComm, PacerModeType InMode /* = PACER_STANDALO
         std::cerr << "Pacer: Error duplicating MPI communicator" << std::endl;
     MPI_Comm_rank(InternalComm, &MyRank);
 
+    // Per-thread storage for handle-based timers
+#ifdef _OPENMP
+    MaxThreads = omp_get_max_threads();
+#endif
+    ThreadGPTLHandles.assign(MaxThreads, std::vector<void*>(HandleNames.size(), nullptr));
+    ThreadOpenCounts.assign(MaxThreads, std::vector<int>(HandleNames.size(), 0));
+
     if (PacerMode == PACER_STANDALONE ) {
         // GPTL set default options
         PACER_CHECK_ERROR(GPTLsetoption(GPTLdepthlimit, 20));
@@ -140,6 +185,125 @@ bool Pacer::stop(const std::string &TimerName)
     return true;
 }
 
+/// Registers the timer TimerName and returns its handle
+/// Returns -1 if Pacer is not initialized
+Pacer::TimerHandle Pacer::registerTimer(const std::string &TimerName)
+{
+    if (!isInitialized())
+        return -1;
+
+    for (size_t i = 0; i < HandleNames.size(); i++) {
+        if (HandleNames[i] == TimerName)
+            return static_cast<TimerHandle>(i);
+    }
+
+    HandleNames.push_back(TimerName);
+    for (int t = 0; t < MaxThreads; t++) {
+        ThreadGPTLHandles[t].push_back(nullptr);
+        ThreadOpenCounts[t].push_back(0);
+    }
+
+    return static_cast<TimerHandle>(HandleNames.size() - 1);
+}
+
+/// Start the timer with handle Handle on the calling thread
+bool Pacer::start(TimerHandle Handle)
+{
+    PACER_CHECK_INIT();
+
+    int Thread = getThreadId();
+    if (!isValidHandle(Handle, Thread))
+        return false;
+
+    PACER_CHECK_ERROR(GPTLstart_handle(HandleNames[Handle].c_str(),
+                                       &ThreadGPTLHandles[Thread][Handle]));
+    ThreadOpenCounts[Thread][Handle]++;
+
+    if (TraceCapacity > 0)
+        recordTraceEvent(Handle, Thread, true);
+
+    return true;
+}
+
+/// Stop the timer with handle Handle on the calling thread
+/// Issues warning if timer hasn't been started yet
+bool Pacer::stop(TimerHandle Handle)
+{
+    PACER_CHECK_INIT();
+
+    int Thread = getThreadId();
+    if (!isValidHandle(Handle, Thread))
+        return false;
+
+    if (ThreadOpenCounts[Thread][Handle] == 0) {
+        std::cerr << "[WARNING] Pacer: Trying to stop timer: \""
+            << HandleNames[Handle] << "\" before starting it." << std::endl;
+        return false;
+    }
+
+    if (TraceCapacity > 0)
+        recordTraceEvent(Handle, Thread, false);
+
+    PACER_CHECK_ERROR(GPTLstop_handle(HandleNames[Handle].c_str(),
+                                      &ThreadGPTLHandles[Thread][Handle]));
+    ThreadOpenCounts[Thread][Handle]--;
+
+    return true;
+}
+
+/// Record begin/end events of handle-based timers in per-thread
+/// ring buffers holding the last Capacity events (0 disables tracing)
+bool Pacer::enableTrace(size_t Capacity)
+{
+    PACER_CHECK_INIT();
+
+    TraceCapacity = Capacity;
+    ThreadTraces.assign(MaxThreads, std::vector<TraceEvent>(Capacity));
+    ThreadTraceCounts.assign(MaxThreads, 0);
+
+    return true;
+}
+
+/// Writes recorded events in Chrome/Perfetto trace (JSON) format
+/// Output File: TraceFilePrefix.trace.<MyRank>.json
+/// Timestamps are in microseconds; events overwritten in the ring
+/// buffer may leave unmatched begin/end events, which viewers tolerate.
+bool Pacer::exportTrace(const std::string &TraceFilePrefix)
+{
+    PACER_CHECK_INIT();
+
+    if (TraceCapacity == 0) {
+        std::cerr << "[WARNING] Pacer: Tracing is not enabled, no trace written." << std::endl;
+        return false;
+    }
+
+    std::string TraceFileName = TraceFilePrefix + ".trace." + std::to_string(MyRank) + ".json";
+    std::ofstream TraceFile(TraceFileName);
+    if (!TraceFile) {
+        std::cerr << "[ERROR] Pacer: Unable to open trace file: " << TraceFileName << std::endl;
+        return false;
+    }
+
+    TraceFile << "{\"traceEvents\":[";
+    bool First = true;
+    for (int t = 0; t < MaxThreads; t++) {
+        size_t Count = ThreadTraceCounts[t];
+        size_t Begin = Count > TraceCapacity ? Count - TraceCapacity : 0;
+        for (size_t n = Begin; n < Count; n++) {
+            const TraceEvent &Event = ThreadTraces[t][n % TraceCapacity];
+            TraceFile << (First ? "\n" : ",\n")
+                << "{\"name\":\"" << HandleNames[Event.Handle] << "\","
+                << "\"ph\":\"" << (Event.IsBegin ? "B" : "E") << "\","
+                << "\"ts\":" << std::fixed << Event.Time * 1.0e6 << ","
+                << "\"pid\":" << MyRank << ",\"tid\":" << t << "}";
+            First = false;
+        }
+    }
+    TraceFile << "\n]}" << std::endl;
+
+    return true;
+}
+
 /// Sets named prefix for all subsequent timers
 bool Pacer::setPrefix(const std::string &Prefix)
 {
@@ -200,6 +364,23 @@ bool Pacer::finalize()
     }
     OpenTimers.clear();
 
+    if (MyRank == 0) {
+        for (size_t i = 0; i < HandleNames.size(); i++) {
+            for (int t = 0; t < MaxThreads; t++) {
+                if (ThreadOpenCounts[t][i] > 0) {
+                    std::cerr << "[WARNING] Pacer: Timer \"" << HandleNames[i]
+                        << "\" is still open on thread " << t << "." << std::endl;
+                }
+            }
+        }
+    }
+    HandleNames.clear();
+    ThreadGPTLHandles.clear();
+    ThreadOpenCounts.clear();
+    ThreadTraces.clear();
+    ThreadTraceCounts.clear();
+    TraceCapacity = 0;
+
     // Clear Pacer state and free communicator
     IsInitialized = false;
     MPI_Comm_free(&InternalComm);
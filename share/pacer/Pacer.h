@@ -15,6 +15,7 @@
 #include <gptl.h>
 #include <unordered_map>
 #include <string>
+#include <vector>
 
 namespace Pacer {
 
@@ -30,6 +31,30 @@ namespace Pacer {
     /// hash table of open timers with count (for multiple parents)
     static std::unordered_map<std::string,int> OpenTimers;
 
+    /// Integer id of a timer registered with registerTimer
+    typedef int TimerHandle;
+
+    /// Names of registered timers, indexed by TimerHandle
+    static std::vector<std::string> HandleNames;
+
+    /// Per-thread GPTL handles and open counts, indexed [thread][TimerHandle]
+    static std::vector<std::vector<void*>> ThreadGPTLHandles;
+    static std::vector<std::vector<int>> ThreadOpenCounts;
+
+    /// One begin or end event recorded for trace export
+    struct TraceEvent {
+        TimerHandle Handle;
+        bool IsBegin;
+        double Time;
+    };
+
+    /// Per-thread ring buffers of trace events and their write positions
+    static std::vector<std::vector<TraceEvent>> ThreadTraces;
+    static std::vector<size_t> ThreadTraceCounts;
+
+    /// Capacity of each per-thread trace buffer (0: tracing disabled)
+    static size_t TraceCapacity = 0;
+
     enum PacerModeType { PACER_STANDALONE, PACER_INTEGRATED };
 
     /// Pacer Mode: standalone or within CIME
@@ -54,6 +79,28 @@ namespace Pacer {
     /// Issues warning if timer hasn't been started yet
     bool stop(const std::string &TimerName);
 
+    /// Registers the timer TimerName and returns its handle
+    /// Registering an already registered name returns the existing handle.
+    /// Must be called outside of threaded regions.
+    TimerHandle registerTimer(const std::string &TimerName);
+
+    /// Start the timer with handle Handle on the calling thread
+    /// Avoids string hashing; intended for timers inside inner loops
+    bool start(TimerHandle Handle);
+
+    /// Stop the timer with handle Handle on the calling thread
+    /// Issues warning if timer hasn't been started yet
+    bool stop(TimerHandle Handle);
+
+    /// Record begin/end events of handle-based timers in per-thread
+    /// ring buffers holding the last Capacity events (0 disables tracing)
+    /// Must be called outside of threaded regions.
+    bool enableTrace(size_t Capacity);
+
+    /// Writes recorded events in Chrome/Perfetto trace (JSON) format
+    /// Output File: TraceFilePrefix.trace.<MyRank>.json
+    bool exportTrace(const std::string &TraceFilePrefix);
+
     /// Sets named prefix for all subsequent timers
     bool setPrefix(const std::string &Prefix);
 
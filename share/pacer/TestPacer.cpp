@@ -6,8 +6,8 @@
 // This test exercises basic timer functionality
 // with the Pacer API.
 //
-// This test program should create two files:
-// test.timing.0 and test.summary
+// This test program should create three files:
+// test.timing.0, test.summary and test.trace.0.json
 // It is also expected to issue couple of warnings
 // to illustrate likely scenarios where a timer is
 // not started/stopped properly.
@@ -44,6 +44,22 @@ int main(int argc, char **argv){
 
     Pacer::unsetPrefix();
 
+    // handle-based timers avoid string lookups in inner loops
+    // begin/end events are recorded for trace export once enabled
+    Pacer::enableTrace(1024);
+    Pacer::TimerHandle inner = Pacer::registerTimer("inner_loop");
+
+    for (int j = 0; j < 100; j++){
+        Pacer::start(inner);
+        for (int i = 1; i <= 100; i++){
+            tmp *= i;
+        }
+        Pacer::stop(inner);
+    }
+
+    // writes test.trace.<rank>.json, viewable in chrome://tracing or Perfetto
+    Pacer::exportTrace("test");
+
     // illustrating situation where attempt to stop timer before starting
     // will print a warning
     Pacer::stop("final");